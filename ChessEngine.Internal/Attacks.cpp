@@ -0,0 +1,395 @@
+#include "pch.h"
+
+#include "Attacks.h"
+
+#include "Helper.h"
+
+// PEXT is only available on x64, elsewhere only the magic bitboard backend is compiled
+#if defined(_M_X64) || defined(__x86_64__)
+#define ATTACKS_PEXT_AVAILABLE
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#define ATTACKS_TARGET_BMI2
+#else
+#include <cpuid.h>
+#define ATTACKS_TARGET_BMI2 __attribute__((target("bmi2")))
+#endif
+#endif
+
+namespace ChessEngine
+{
+    namespace
+    {
+        // The magic numbers for rooks on each square. A magic number maps every subset of the relevant
+        // occupied squares for a rook to a unique index into its attack table (or at least an index
+        // which shares the same attacks). These were found by trial with a fixed-seed splitmix64.
+        constexpr Bitboard RookMagics[64] = {
+            0x0080'0216'2080'4001, 0x0040'0010'0020'0041, 0x0200'1022'0008'8040, 0x4080'0408'0082'1000,
+            0x2200'0200'0420'0810, 0x4B00'020C'000D'0008, 0x0100'0C41'8300'0600, 0x2080'0100'0040'2C80,
+            0x8002'8008'2686'4000, 0x0410'8020'0088'4000, 0x0C01'0040'1020'0100, 0x0203'0010'0100'203C,
+            0x0450'8008'0104'0080, 0x4010'8002'0004'0080, 0x8804'0002'0804'8110, 0x0C40'8000'8000'4100,
+            0xA201'8880'0240'04A0, 0x0080'8480'2000'4004, 0x1010'4100'1020'0101, 0x2010'0080'0800'8010,
+            0x0A08'0100'0411'0008, 0x0802'0801'0420'9040, 0x0080'0400'9001'0802, 0x0280'0200'0084'1069,
+            0x080C'4000'8024'8000, 0x2048'8501'0022'4008, 0x0020'0800'C030'0040, 0x1140'0D01'0020'1000,
+            0x0041'0011'0008'0204, 0x4802'0002'0004'0810, 0x0100'080C'0010'3601, 0x0020'0842'0004'3085,
+            0x0100'8040'0080'0022, 0x0460'4010'0040'2002, 0x8309'0020'0100'1044, 0x0000'8008'0080'1000,
+            0x0000'8008'0080'0400, 0xB542'0400'8080'0200, 0x1041'0004'0100'0200, 0x0003'18B0'4A00'0401,
+            0x0280'0820'0048'4000, 0x0080'4000'8101'0030, 0x0010'0020'0010'8080, 0x0120'1000'2101'000A,
+            0x0801'0004'0801'0012, 0x0004'0080'0200'8004, 0x0AD1'0052'0011'0014, 0x4000'0041'1082'0004,
+            0x9400'4000'8000'3080, 0x0000'8022'0049'0200, 0x1521'1000'8020'0280, 0x9021'0008'2410'0100,
+            0x0081'0800'8084'0280, 0x0002'0009'0410'0200, 0x0130'0248'0130'2400, 0x0102'0081'0044'2200,
+            0x0080'9840'6380'0101, 0x0016'8102'0141'2812, 0x4020'0101'6030'08C1, 0x2851'1000'0408'2101,
+            0x1049'0010'0288'0005, 0x0081'0008'0400'0201, 0x1000'2090'1208'410C, 0x0101'0644'0081'3102
+        };
+
+        // The magic numbers for bishops on each square (see RookMagics)
+        constexpr Bitboard BishopMagics[64] = {
+            0x24E0'440C'0080'2202, 0x0088'1808'841A'4500, 0x29C1'0210'8500'4190, 0x18C4'0410'8004'2020,
+            0x0841'1040'0000'8108, 0x8908'2808'0880'C088, 0x0006'0210'2406'2018, 0x2000'4040'4410'4040,
+            0x0900'0504'104A'0210, 0x0088'3902'0404'0820, 0x4001'4200'8200'8402, 0x0281'0804'8B00'1142,
+            0x1C00'1404'2100'1008, 0x0008'0212'1220'0400, 0x0800'0058'1A08'2004, 0x3000'0482'0802'7204,
+            0x0120'0040'4414'8482, 0x4021'0008'0810'8090, 0x0084'0118'0800'9452, 0x11C8'0224'2020'E000,
+            0x0124'0022'1014'0002, 0x4009'0082'0042'0200, 0x0000'8302'0210'0202, 0x9002'0425'0042'0200,
+            0x0A60'2000'0448'0210, 0x0402'4810'2048'0080, 0x8001'1001'0100'4200, 0x6240'1040'0400'4080,
+            0x1124'8480'1400'2000, 0x0018'0200'2041'00A0, 0x8020'8908'4488'0800, 0x0000'8020'0904'0204,
+            0x0410'0420'4110'0280, 0x0804'0220'0002'0440, 0x2418'2804'0048'0024, 0x0801'0808'0042'0A00,
+            0x4002'2484'0002'0020, 0x3020'0041'0203'8084, 0x8428'0110'601C'0200, 0x2004'0042'0808'8080,
+            0x0008'0222'2004'1210, 0x0082'0E01'2000'0440, 0x0002'0022'0102'0822, 0x0000'0020'1900'0804,
+            0x0211'204C'1010'1100, 0x0604'8080'8100'1200, 0x1010'0292'0403'0041, 0x1008'0901'0211'0621,
+            0x0002'0150'0210'0C00, 0x0600'2C04'0404'400A, 0xC030'0022'0110'0011, 0x4040'0080'2088'4000,
+            0x0248'0009'0304'0100, 0xC010'0920'0800'8040, 0x6008'0841'0802'0494, 0x2810'2182'008E'0042,
+            0x0010'2108'2084'2002, 0x4080'0201'1149'1002, 0x0108'1000'8400'8800, 0x0022'2421'0042'0221,
+            0x10A8'0081'1002'0210, 0x4000'1912'2A90'0102, 0x0080'0A10'5108'0300, 0x0420'2220'8800'8080
+        };
+
+        // The row and col offsets of each of the moves for each piece
+        constexpr int KnightOffsets[8][2] = { { +1, +2 }, { +2, +1 }, { +2, -1 }, { +1, -2 }, { -1, -2 }, { -2, -1 }, { -2, +1 }, { -1, +2 } };
+        constexpr int KingOffsets[8][2] = { { +1, -1 }, { +1, 0 }, { +1, +1 }, { 0, -1 }, { 0, +1 }, { -1, -1 }, { -1, 0 }, { -1, +1 } };
+        constexpr int BishopOffsets[4][2] = { { +1, +1 }, { +1, -1 }, { -1, +1 }, { -1, -1 } };
+        constexpr int RookOffsets[4][2] = { { +1, 0 }, { -1, 0 }, { 0, +1 }, { 0, -1 } };
+
+        // The magic bitboard data for a single square
+        struct Magic
+        {
+            Bitboard mask = 0;      // The squares whose occupancy affects the attacks (the rays, excluding the edges of the board)
+            Bitboard magic = 0;     // The magic number
+            unsigned int shift = 0; // The shift which reduces the product of the masked occupancy and magic number to an index
+            size_t offset = 0;      // The offset of this square's attacks within the shared attack table
+
+            // Get the index into the shared attack table for the given occupied squares
+            size_t GetIndex(const Bitboard occupied) const
+            {
+                return offset + static_cast<size_t>(((occupied & mask) * magic) >> shift);
+            }
+
+#if defined(ATTACKS_PEXT_AVAILABLE)
+            // Get the index into the shared PEXT attack table for the given occupied squares (the CPU must support BMI2)
+            ATTACKS_TARGET_BMI2 size_t GetPextIndex(const Bitboard occupied) const
+            {
+                return offset + static_cast<size_t>(_pext_u64(occupied, mask));
+            }
+#endif
+        };
+
+        // All the attack tables
+        struct AttackTables
+        {
+            Bitboard pawn[2][64] = {};  // Indexed by [is black][square]
+            Bitboard knight[64] = {};
+            Bitboard king[64] = {};
+
+            Bitboard between[64][64] = {};  // The squares strictly between two squares on a shared line
+            Bitboard line[64][64] = {};     // The squares on the line through two squares
+
+            Magic bishopMagics[64];
+            Magic rookMagics[64];
+
+            std::vector<Bitboard> bishopAttacks;    // The attacks for every relevant occupancy of every square (5248 entries)
+            std::vector<Bitboard> rookAttacks;      // The attacks for every relevant occupancy of every square (102400 entries)
+
+            std::vector<Bitboard> bishopPextAttacks;    // As above but indexed by the relevant occupancy extracted with PEXT
+            std::vector<Bitboard> rookPextAttacks;      // As above but indexed by the relevant occupancy extracted with PEXT
+        };
+
+        // Helper function getting the squares reached by taking each of the given steps once from a given square
+        template<size_t N> Bitboard GetStepAttacks(const Square square, const int (&offsets)[N][2])
+        {
+            Bitboard attacks = 0;
+
+            for (const auto& offset : offsets)
+            {
+                const int row = Helper::RowFromSquare(square) + offset[0];
+                const int col = Helper::ColFromSquare(square) + offset[1];
+
+                if (row >= 0 && row < 8 && col >= 0 && col < 8)
+                {
+                    attacks |= Helper::SquareBitboard(Helper::SquareFromRowAndCol(Row(row), Col(col)));
+                }
+            }
+
+            return attacks;
+        }
+
+        // Helper function getting the squares reached by sliding along each of the given lines from a given square,
+        // stopping at (and including) the first occupied square. If excludeEdges is set the last square on each
+        // line is excluded, this gives the squares whose occupancy affects the attacks.
+        Bitboard GetSlidingAttacks(const Square square, const Bitboard occupied, const int (&offsets)[4][2], const bool excludeEdges)
+        {
+            Bitboard attacks = 0;
+
+            for (const auto& offset : offsets)
+            {
+                int row = Helper::RowFromSquare(square) + offset[0];
+                int col = Helper::ColFromSquare(square) + offset[1];
+
+                while (row >= 0 && row < 8 && col >= 0 && col < 8)
+                {
+                    const int nextRow = row + offset[0];
+                    const int nextCol = col + offset[1];
+
+                    if (excludeEdges && !(nextRow >= 0 && nextRow < 8 && nextCol >= 0 && nextCol < 8))
+                    {
+                        break;
+                    }
+
+                    const Bitboard squareBitboard = Helper::SquareBitboard(Helper::SquareFromRowAndCol(Row(row), Col(col)));
+                    attacks |= squareBitboard;
+
+                    if (occupied & squareBitboard)
+                    {
+                        break;
+                    }
+
+                    row = nextRow;
+                    col = nextCol;
+                }
+            }
+
+            return attacks;
+        }
+
+        // Helper function filling in the magic bitboard data and attack tables (magic and PEXT) for a sliding piece
+        void InitializeMagics(
+            Magic (&magics)[64],
+            std::vector<Bitboard>& attacks,
+            std::vector<Bitboard>& pextAttacks,
+            const Bitboard (&magicNumbers)[64],
+            const int (&offsets)[4][2])
+        {
+            for (Square square = 0; Helper::IsValidSquare(square); square++)
+            {
+                Magic& magic = magics[square];
+
+                magic.mask = GetSlidingAttacks(square, 0, offsets, true);
+                magic.magic = magicNumbers[square];
+                magic.shift = 64 - Helper::PopCount(magic.mask);
+                magic.offset = attacks.size();
+
+                attacks.resize(attacks.size() + (size_t(1) << Helper::PopCount(magic.mask)));
+                pextAttacks.resize(attacks.size());
+
+                // Enumerate every subset of the mask (Carry-Rippler trick) and store the attacks for it. The subsets
+                // are enumerated in the order of their PEXT index, so the PEXT table can be filled without using PEXT.
+                Bitboard occupied = 0;
+                size_t pextIndex = magic.offset;
+                do
+                {
+                    const Bitboard squareAttacks = GetSlidingAttacks(square, occupied, offsets, false);
+
+                    attacks[magic.GetIndex(occupied)] = squareAttacks;
+                    pextAttacks[pextIndex++] = squareAttacks;
+
+                    occupied = (occupied - magic.mask) & magic.mask;
+                } while (occupied != 0);
+            }
+        }
+
+        AttackTables CreateAttackTables()
+        {
+            AttackTables tables;
+
+            for (Square square = 0; Helper::IsValidSquare(square); square++)
+            {
+                tables.pawn[0][square] = GetStepAttacks(square, { { +1, -1 }, { +1, +1 } });
+                tables.pawn[1][square] = GetStepAttacks(square, { { -1, -1 }, { -1, +1 } });
+                tables.knight[square] = GetStepAttacks(square, KnightOffsets);
+                tables.king[square] = GetStepAttacks(square, KingOffsets);
+            }
+
+            InitializeMagics(tables.bishopMagics, tables.bishopAttacks, tables.bishopPextAttacks, BishopMagics, BishopOffsets);
+            InitializeMagics(tables.rookMagics, tables.rookAttacks, tables.rookPextAttacks, RookMagics, RookOffsets);
+
+            for (Square square1 = 0; Helper::IsValidSquare(square1); square1++)
+            {
+                for (Square square2 = 0; Helper::IsValidSquare(square2); square2++)
+                {
+                    const Bitboard bitboard1 = Helper::SquareBitboard(square1);
+                    const Bitboard bitboard2 = Helper::SquareBitboard(square2);
+
+                    // Two squares share a line iff a bishop or rook on one attacks the other on an empty board, the squares
+                    // between them are then those attacked by a bishop or rook on both when each blocks the other.
+                    auto addLine = [&](const int (&offsets)[4][2]) -> void
+                    {
+                        if (GetSlidingAttacks(square1, 0, offsets, false) & bitboard2)
+                        {
+                            tables.between[square1][square2] =
+                                GetSlidingAttacks(square1, bitboard2, offsets, false) &
+                                GetSlidingAttacks(square2, bitboard1, offsets, false);
+                            tables.line[square1][square2] =
+                                (GetSlidingAttacks(square1, 0, offsets, false) & GetSlidingAttacks(square2, 0, offsets, false)) | bitboard1 | bitboard2;
+                        }
+                    };
+
+                    addLine(BishopOffsets);
+                    addLine(RookOffsets);
+                }
+            }
+
+            return tables;
+        }
+
+        const AttackTables Tables = CreateAttackTables();
+
+#if defined(ATTACKS_PEXT_AVAILABLE)
+        // Helper function running the CPUID instruction for a given leaf and subleaf, returning { EAX, EBX, ECX, EDX }
+        std::array<uint32_t, 4> CpuId(const uint32_t leaf, const uint32_t subleaf)
+        {
+#if defined(_MSC_VER)
+            int registers[4];
+            __cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subleaf));
+            return { uint32_t(registers[0]), uint32_t(registers[1]), uint32_t(registers[2]), uint32_t(registers[3]) };
+#else
+            uint32_t registers[4];
+            __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+            return { registers[0], registers[1], registers[2], registers[3] };
+#endif
+        }
+
+        // Helper function checking the CPUID feature flags for BMI2
+        bool DetectBmi2()
+        {
+            const uint32_t maxLeaf = CpuId(0, 0)[0];
+            return (maxLeaf >= 7) && ((CpuId(7, 0)[1] & (1U << 8)) != 0);
+        }
+
+        // Helper function checking whether the CPU implements PEXT in microcode (AMD before Zen 3), in which case
+        // it is much slower than a magic multiply even though it is supported
+        bool DetectSlowPext()
+        {
+            const auto vendor = CpuId(0, 0);
+            const bool isAmd = (vendor[1] == 0x6874'7541) && (vendor[3] == 0x6974'6E65) && (vendor[2] == 0x444D'4163); // "AuthenticAMD"
+
+            const uint32_t signature = CpuId(1, 0)[0];
+            const uint32_t baseFamily = (signature >> 8) & 0xF;
+            const uint32_t family = (baseFamily == 0xF) ? (baseFamily + ((signature >> 20) & 0xFF)) : baseFamily;
+
+            return isAmd && (family < 0x19);
+        }
+
+        const bool IsBmi2Supported = DetectBmi2();
+#else
+        const bool IsBmi2Supported = false;
+#endif
+
+        // Helper function choosing the fastest backend the CPU supports
+        Attacks::Backend ChooseBackend()
+        {
+#if defined(ATTACKS_PEXT_AVAILABLE)
+            if (IsBmi2Supported && !DetectSlowPext())
+            {
+                return Attacks::Backend::Pext;
+            }
+#endif
+            return Attacks::Backend::Magic;
+        }
+
+        Attacks::Backend SelectedBackend = ChooseBackend();
+    }
+
+    bool Attacks::IsPextSupported()
+    {
+        return IsBmi2Supported;
+    }
+
+    Attacks::Backend Attacks::GetBackend()
+    {
+        return SelectedBackend;
+    }
+
+    void Attacks::SetBackend(const Backend backend)
+    {
+        if (backend == Backend::Pext && !IsPextSupported())
+        {
+            throw std::runtime_error("The PEXT attacks backend is not supported by this CPU");
+        }
+
+        SelectedBackend = backend;
+    }
+
+    std::string Attacks::GetBackendName(const Backend backend)
+    {
+        return (backend == Backend::Pext ? "PEXT" : "Magic");
+    }
+
+    Bitboard Attacks::GetPawnAttacks(const Square square, const bool isWhite)
+    {
+        return Tables.pawn[isWhite ? 0 : 1][square];
+    }
+
+    Bitboard Attacks::GetKnightAttacks(const Square square)
+    {
+        return Tables.knight[square];
+    }
+
+    Bitboard Attacks::GetKingAttacks(const Square square)
+    {
+        return Tables.king[square];
+    }
+
+    Bitboard Attacks::GetBishopAttacks(const Square square, const Bitboard occupied)
+    {
+#if defined(ATTACKS_PEXT_AVAILABLE)
+        if (SelectedBackend == Backend::Pext)
+        {
+            return Tables.bishopPextAttacks[Tables.bishopMagics[square].GetPextIndex(occupied)];
+        }
+#endif
+        return Tables.bishopAttacks[Tables.bishopMagics[square].GetIndex(occupied)];
+    }
+
+    Bitboard Attacks::GetRookAttacks(const Square square, const Bitboard occupied)
+    {
+#if defined(ATTACKS_PEXT_AVAILABLE)
+        if (SelectedBackend == Backend::Pext)
+        {
+            return Tables.rookPextAttacks[Tables.rookMagics[square].GetPextIndex(occupied)];
+        }
+#endif
+        return Tables.rookAttacks[Tables.rookMagics[square].GetIndex(occupied)];
+    }
+
+    Bitboard Attacks::GetQueenAttacks(const Square square, const Bitboard occupied)
+    {
+        return GetBishopAttacks(square, occupied) | GetRookAttacks(square, occupied);
+    }
+
+    Bitboard Attacks::GetBetween(const Square square1, const Square square2)
+    {
+        return Tables.between[square1][square2];
+    }
+
+    Bitboard Attacks::GetLine(const Square square1, const Square square2)
+    {
+        return Tables.line[square1][square2];
+    }
+
+    Bitboard Attacks::GetBishopAttacksSlow(const Square square, const Bitboard occupied)
+    {
+        return GetSlidingAttacks(square, occupied, BishopOffsets, false);
+    }
+
+    Bitboard Attacks::GetRookAttacksSlow(const Square square, const Bitboard occupied)
+    {
+        return GetSlidingAttacks(square, occupied, RookOffsets, false);
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Definitions.h"
+
+namespace ChessEngine
+{
+    // Precomputed attack tables for each piece. The attacks of the sliding pieces (bishops, rooks and queens)
+    // are looked up using magic bitboards, so that finding them takes constant time regardless of the position.
+    // See https://www.chessprogramming.org/Magic_Bitboards for a description of the technique.
+    //
+    // On CPUs with fast BMI2 instructions the index into the sliding attack tables is instead computed with
+    // a single PEXT instruction. The backend is chosen once at startup based on CPUID so that the same binary
+    // runs on any x64 CPU (see https://www.chessprogramming.org/BMI2#PEXTBitboards).
+    class Attacks
+    {
+    public:
+
+        // The methods of looking up the attacks of the sliding pieces
+        enum class Backend
+        {
+            Magic,  // Multiply the occupied squares by a magic number (portable)
+            Pext,   // Extract the occupied squares with the BMI2 PEXT instruction (x64 only)
+        };
+
+        // Get whether the CPU supports the BMI2 PEXT instruction
+        static bool IsPextSupported();
+
+        // Get the backend which is used to look up the attacks of the sliding pieces
+        static Backend GetBackend();
+
+        // Set the backend which is used to look up the attacks of the sliding pieces
+        // (this throws if the CPU does not support the backend, it is chosen automatically at startup)
+        static void SetBackend(const Backend backend);
+
+        // Get the name of a backend (ex. "Magic" or "PEXT")
+        static std::string GetBackendName(const Backend backend);
+
+        // Get the squares attacked by a white/black pawn on the given square
+        static Bitboard GetPawnAttacks(const Square square, const bool isWhite);
+
+        // Get the squares attacked by a knight on the given square
+        static Bitboard GetKnightAttacks(const Square square);
+
+        // Get the squares attacked by a king on the given square
+        static Bitboard GetKingAttacks(const Square square);
+
+        // Get the squares attacked by a bishop on the given square, given the occupied squares on the board
+        static Bitboard GetBishopAttacks(const Square square, const Bitboard occupied);
+
+        // Get the squares attacked by a rook on the given square, given the occupied squares on the board
+        static Bitboard GetRookAttacks(const Square square, const Bitboard occupied);
+
+        // Get the squares attacked by a queen on the given square, given the occupied squares on the board
+        static Bitboard GetQueenAttacks(const Square square, const Bitboard occupied);
+
+        // Get the squares strictly between two squares if they share a diagonal, rank or file (otherwise 0)
+        static Bitboard GetBetween(const Square square1, const Square square2);
+
+        // Get all the squares on the diagonal, rank or file through two squares if they share one (otherwise 0)
+        static Bitboard GetLine(const Square square1, const Square square2);
+
+        // Get the squares attacked by a bishop/rook on the given square by walking each ray one square at a time
+        // (slow, this is used to build the attack tables and to test them)
+        static Bitboard GetBishopAttacksSlow(const Square square, const Bitboard occupied);
+        static Bitboard GetRookAttacksSlow(const Square square, const Bitboard occupied);
+    };
+}
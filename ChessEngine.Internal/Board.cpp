@@ -12,6 +12,7 @@ namespace ChessEngine
     Board::Board():
         m_pieces(StartingPieces)
     {
+        SetBitboards();
         m_boardHasher.SetHash(*this);
     }
 
@@ -84,16 +85,16 @@ namespace ChessEngine
         {
             switch (token)
             {
-            case 'k':
+            case 'K':
                 m_whiteKingside = true;
                 break;
-            case 'q':
+            case 'Q':
                 m_whiteQueenside = true;
                 break;
-            case 'K':
+            case 'k':
                 m_blackKingside = true;
                 break;
-            case 'Q':
+            case 'q':
                 m_blackQueenside = true;
                 break;
             case '-':
@@ -122,7 +123,8 @@ namespace ChessEngine
         m_halfMoves = static_cast<unsigned char>(halfMoves);
         m_fullMoves = static_cast<unsigned char>(fullMoves);
 
-        // Get the hash for this position
+        // Get the bitboards and hash for this position
+        SetBitboards();
         m_boardHasher.SetHash(*this);
     }
 
@@ -209,6 +211,8 @@ namespace ChessEngine
 
     void Board::MakeMove(const Move move)
     {
+        m_hashHistory.push_back(GetHash());
+
         // It is assumed that the move provided is a valid move. Checking of whether a
         // move is valid will be done at the point where the user move is parsed. All
         // computer generated moves should be legal.
@@ -288,6 +292,24 @@ namespace ChessEngine
             }
         }
 
+        // Capturing a rook on its starting square also removes the right to castle with it
+        if (dest == WhiteKingsideRookStartingSquare)
+        {
+            SetCanWhiteCastleKingside(false);
+        }
+        else if (dest == WhiteQueensideRookStartingSquare)
+        {
+            SetCanWhiteCastleQueenside(false);
+        }
+        else if (dest == BlackKingsideRookStartingSquare)
+        {
+            SetCanBlackCastleKingside(false);
+        }
+        else if (dest == BlackQueensideRookStartingSquare)
+        {
+            SetCanBlackCastleQueenside(false);
+        }
+
         // Update en passan square
         if (move.IsDoublePawnPush())
         {
@@ -380,14 +402,135 @@ namespace ChessEngine
 
         // Update whose turn it is to play
         SetWhiteToPlay(!m_whiteToPlay);
+
+        m_hashHistory.pop_back();
+    }
+
+    void Board::MakeNullMove()
+    {
+        // Only the state which doesn't depend on the pieces changes, en passant is no longer possible
+        // as it must be taken immediately after the double pawn push (the hash is updated to match)
+        m_hashHistory.push_back(GetHash());
+
+        SetEnPassant(std::nullopt);
+
+        // The null move is treated as irreversible, so that no position before it (which couldn't actually be repeated
+        // on the board) is found as a repetition
+        m_halfMoves = 0;
+
+        if (!m_whiteToPlay)
+        {
+            m_fullMoves++;
+        }
+
+        SetWhiteToPlay(!m_whiteToPlay);
+    }
+
+    void Board::UndoNullMove(const MoveInverse moveInverse)
+    {
+        SetEnPassant(moveInverse.GetEnPassant());
+
+        m_halfMoves = moveInverse.GetHalfMoves();
+
+        if (m_whiteToPlay)
+        {
+            m_fullMoves--;
+        }
+
+        SetWhiteToPlay(!m_whiteToPlay);
+
+        m_hashHistory.pop_back();
+    }
+
+    bool Board::IsRepetition() const
+    {
+        return CountRepetitions(1) >= 1;
+    }
+
+    bool Board::IsThreefoldRepetition() const
+    {
+        return CountRepetitions(2) >= 2;
+    }
+
+    bool Board::IsInsufficientMaterial() const
+    {
+        if (GetBitboard(Piece::Type::Pawn) || GetBitboard(Piece::Type::Rook) || GetBitboard(Piece::Type::Queen))
+        {
+            return false;
+        }
+
+        const Bitboard knights = GetBitboard(Piece::Type::Knight);
+        const Bitboard bishops = GetBitboard(Piece::Type::Bishop);
+
+        // A single minor piece can't checkmate (nor can the kings alone)
+        if (Helper::PopCount(knights | bishops) <= 1)
+        {
+            return true;
+        }
+
+        // Bishops which are all on squares of the same colour can't checkmate either
+        constexpr Bitboard LightSquares = 0x55AA55AA55AA55AA;
+        return (knights == 0) && ((bishops & LightSquares) == 0 || (bishops & ~LightSquares) == 0);
+    }
+
+    int Board::CountRepetitions(const int maxRepetitions) const
+    {
+        // The same player must be to move so only every second position is checked, the positions before the last
+        // irreversible move (or those before the board was created from a FEN string) can't be the same position
+        const size_t numReversible = std::min(static_cast<size_t>(m_halfMoves), m_hashHistory.size());
+        const uint64_t hash = GetHash();
+
+        int repetitions = 0;
+        for (size_t i = 2; i <= numReversible; i += 2)
+        {
+            if (m_hashHistory[m_hashHistory.size() - i] == hash && ++repetitions >= maxRepetitions)
+            {
+                break;
+            }
+        }
+
+        return repetitions;
     }
 
     void Board::SetPiece(const Square square, const Piece piece)
     {
-        m_boardHasher.UpdatePiece(square, m_pieces[square], piece);
+        const Piece oldPiece = m_pieces[square];
+        const Bitboard squareBitboard = Helper::SquareBitboard(square);
+
+        m_bitboards[oldPiece.GetIndex()] ^= squareBitboard;
+        m_bitboards[piece.GetIndex()] ^= squareBitboard;
+
+        if (!oldPiece.IsEmpty())
+        {
+            m_colourBitboards[oldPiece.IsWhite() ? 0 : 1] ^= squareBitboard;
+        }
+        if (!piece.IsEmpty())
+        {
+            m_colourBitboards[piece.IsWhite() ? 0 : 1] ^= squareBitboard;
+        }
+
+        m_boardHasher.UpdatePiece(square, oldPiece, piece);
         m_pieces[square] = piece;
     }
 
+    void Board::SetBitboards()
+    {
+        m_bitboards.fill(0);
+        m_colourBitboards.fill(0);
+
+        for (Square square = 0; Helper::IsValidSquare(square); square++)
+        {
+            const Piece piece = m_pieces[square];
+
+            m_bitboards[piece.GetIndex()] |= Helper::SquareBitboard(square);
+
+            if (!piece.IsEmpty())
+            {
+                m_colourBitboards[piece.IsWhite() ? 0 : 1] |= Helper::SquareBitboard(square);
+            }
+        }
+    }
+
     void Board::SetEnPassant(const EnPassant& enPassant)
     {
         m_boardHasher.UpdateEnPassant(m_enPassant, enPassant);
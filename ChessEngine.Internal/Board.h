@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "BoardHasher.h"
 #include "Definitions.h"
 #include "Piece.h"
@@ -34,9 +36,35 @@ namespace ChessEngine
         // Update the board as per the given move inverse
         void UndoMove(const MoveInverse moveInverse);
 
+        // Pass the turn to the other player without moving a piece (a 'null move'), this is not a legal move
+        // but is used by the search to test whether a position is so good that the player could skip their turn.
+        // The half move counter is reset, so that repetitions are only checked back to the null move.
+        void MakeNullMove();
+
+        // Undo a null move as per the given move inverse (created with Move() before making the null move)
+        void UndoNullMove(const MoveInverse moveInverse);
+
         // Get the pieces locations on the board
         const PieceArray& GetPieces() const { return m_pieces; }
 
+        // Get the bitboard of the squares occupied by the given piece (type and colour)
+        Bitboard GetBitboard(const Piece piece) const { return m_bitboards[piece.GetIndex()]; }
+
+        // Get the bitboard of the squares occupied by pieces of the given type (of either colour)
+        Bitboard GetBitboard(const Piece::Type type) const
+        {
+            return m_bitboards[Piece::IndexFromType(type, true)] | m_bitboards[Piece::IndexFromType(type, false)];
+        }
+
+        // Get the bitboard of the squares occupied by pieces of the given type and colour
+        Bitboard GetBitboard(const Piece::Type type, const bool isWhite) const { return m_bitboards[Piece::IndexFromType(type, isWhite)]; }
+
+        // Get the bitboard of the squares occupied by the white/black pieces
+        Bitboard GetColourBitboard(const bool isWhite) const { return m_colourBitboards[isWhite ? 0 : 1]; }
+
+        // Get the bitboard of the squares occupied by any piece
+        Bitboard GetOccupiedBitboard() const { return m_colourBitboards[0] | m_colourBitboards[1]; }
+
         // Get the en passant square (if en passant is possible)
         const EnPassant& GetEnPassant() const { return m_enPassant; }
 
@@ -55,7 +83,21 @@ namespace ChessEngine
         unsigned char GetFullMoves() const { return m_fullMoves; }
 
         // Get the Zobrist hash for the position
-        unsigned int GetHash() const { return m_boardHasher.GetHash(); }
+        uint64_t GetHash() const { return m_boardHasher.GetHash(); }
+
+        // Get whether the position has occurred before, only the positions since the last irreversible move
+        // (a capture or pawn move, after which no earlier position can occur again) are checked
+        bool IsRepetition() const;
+
+        // Get whether the position has occurred (at least) twice before, drawing the game by threefold repetition
+        bool IsThreefoldRepetition() const;
+
+        // Get whether the game is drawn by the fifty move rule (one hundred half moves without an irreversible move)
+        bool IsFiftyMoveDraw() const { return m_halfMoves >= 100; }
+
+        // Get whether neither player has enough material to checkmate (the kings alone, a single minor piece
+        // or only bishops all on squares of the same colour), drawing the game
+        bool IsInsufficientMaterial() const;
 
     private:
 
@@ -63,9 +105,15 @@ namespace ChessEngine
         // We need to update the Zobrist hash as we update the board's state. These helper functions
         // below do this so should be used to update the board's state rather than doing so directly.
 
-        // Helper function for setting the piece on a given square (also updates the hash)
+        // Helper function for counting the earlier occurrences of the position (stopping once the given number are found)
+        int CountRepetitions(const int maxRepetitions) const;
+
+        // Helper function for setting the piece on a given square (also updates the hash and bitboards)
         void SetPiece(const Square square, const Piece piece);
 
+        // Helper function for setting the bitboards from the piece array (used when the piece array is set directly)
+        void SetBitboards();
+
         // Helper function for setting the en passant square (also updates the hash)
         void SetEnPassant(const EnPassant& enPassant);
 
@@ -110,6 +158,9 @@ namespace ChessEngine
 
         PieceArray m_pieces;    // The pieces locations on the board
 
+        std::array<Bitboard, Piece::NumIndices> m_bitboards{};  // The squares occupied by each piece (indexed by Piece::GetIndex)
+        std::array<Bitboard, 2> m_colourBitboards{};            // The squares occupied by the white and black pieces
+
         EnPassant m_enPassant;  // The en passant square (if en passant is possible)
 
         bool m_whiteKingside = true;    // Whether white can castle kingside
@@ -123,6 +174,8 @@ namespace ChessEngine
         unsigned char m_fullMoves = 0;  // The number of full moves played
 
         BoardHasher m_boardHasher;  // The hasher for this board
+
+        std::vector<uint64_t> m_hashHistory;    // The hashes of the positions before each move made (oldest first)
     };
 }
 
@@ -106,15 +106,12 @@ namespace ChessEngine
 
         // First pass, get unmodified piece values and fill the foremost
         // and rearmost pawn arrays for both white and black
-        for (Square square = 0; Helper::IsValidSquare(square); square++)
+        for (Bitboard occupied = board.GetOccupiedBitboard(); occupied != 0;)
         {
+            const Square square = Helper::PopLowestSquare(occupied);
             const Piece piece = board.GetPieces()[square];
 
-            if (piece == Piece::ee)
-            {
-                continue;
-            }
-            else if (piece == Piece::wp)
+            if (piece == Piece::wp)
             {
                 const Row row = Helper::RowFromSquare(square);
                 const Col col = Helper::ColFromSquare(square);
@@ -163,15 +160,12 @@ namespace ChessEngine
         m_blackScore = m_blackPawnValues + m_blackPieceValues;
 
         // Second pass, apply bonuses and penalties for piece placement, pawn structure, king safety etc.
-        for (Square square = 0; Helper::IsValidSquare(square); square++)
+        for (Bitboard occupied = board.GetOccupiedBitboard(); occupied != 0;)
         {
+            const Square square = Helper::PopLowestSquare(occupied);
             const Piece piece = board.GetPieces()[square];
 
-            if (piece == Piece::ee)
-            {
-                continue;
-            }
-            else if (piece == Piece::wp)
+            if (piece == Piece::wp)
             {
                 m_whiteScore += EvaluateWhitePawn(board, square);
             }
@@ -220,6 +214,20 @@ namespace ChessEngine
             );
     }
 
+    int BoardEvaluator::GetPieceValue(const Piece::Type type)
+    {
+        switch (type)
+        {
+        case Piece::Type::Pawn:   return PawnValue;
+        case Piece::Type::Knight: return KnightValue;
+        case Piece::Type::Bishop: return BishopValue;
+        case Piece::Type::Rook:   return RookValue;
+        case Piece::Type::Queen:  return QueenValue;
+        case Piece::Type::King:   return KingValue;
+        default:                  return 0;
+        }
+    }
+
     int BoardEvaluator::EvaluateWhitePawn(const Board& board, const Square square) const
     {
         const Piece piece = board.GetPieces()[square];
@@ -14,6 +14,7 @@
 **************************************************************************************/
 
 #include "Definitions.h"
+#include "Piece.h"
 
 namespace ChessEngine
 {
@@ -24,6 +25,9 @@ namespace ChessEngine
         // Evaluate a board position from the perspective of the player to move
         int Evaluate(const Board& board);
 
+        // Get the base value of a type of piece (ignoring its position), this is zero for an empty square
+        static int GetPieceValue(const Piece::Type type);
+
     private:
 
         // Evaluate a white/black pawn for bonuses/penalties beyond its base value
@@ -9,89 +9,121 @@
 
 namespace
 {
-    std::map<ChessEngine::Piece::Type, std::array<unsigned int, 64>> WhitePieceRandNums;
-    std::map<ChessEngine::Piece::Type, std::array<unsigned int, 64>> BlackPieceRandNums;
+    using ChessEngine::Piece;
 
-    unsigned int WhiteToPlayRandNum;
+    constexpr uint64_t Seed = 0x1234'5678'9ABC'DEF0;    // The fixed seed for the random numbers used for zobrist hashing
 
-    unsigned int WhiteKingsideCastlingRandNum;
-    unsigned int WhiteQueensideCastlingRandNum;
-    unsigned int BlackKingsideCastlingRandNum;
-    unsigned int BlackQueensideCastlingRandNum;
+    // The random numbers used for zobrist hashing, these are generated at compile time
+    struct ZobristKeys
+    {
+        uint64_t pieces[Piece::NumIndices][64] = {};    // Indexed by [piece index][square], zero for empty squares
+
+        uint64_t whiteToPlay = 0;
+
+        uint64_t whiteKingsideCastling = 0;
+        uint64_t whiteQueensideCastling = 0;
+        uint64_t blackKingsideCastling = 0;
+        uint64_t blackQueensideCastling = 0;
+
+        uint64_t enPassant[8] = {};     // Indexed by the column of the en passant square
+    };
+
+    constexpr ZobristKeys CreateZobristKeys()
+    {
+        ZobristKeys keys;
+
+        uint64_t state = Seed;
+
+        for (size_t index = 0; index < Piece::NumIndices; index++)
+        {
+            // Empty squares don't contribute to the hash
+            if (index == Piece::IndexFromType(Piece::Type::Empty, true) ||
+                index == Piece::IndexFromType(Piece::Type::Empty, false))
+            {
+                continue;
+            }
 
-    std::array<unsigned int, 8> EnPassantRandNums;
+            for (auto& key : keys.pieces[index])
+            {
+                key = ChessEngine::Helper::SplitMix64(state);
+            }
+        }
+
+        keys.whiteToPlay = ChessEngine::Helper::SplitMix64(state);
+
+        keys.whiteKingsideCastling = ChessEngine::Helper::SplitMix64(state);
+        keys.whiteQueensideCastling = ChessEngine::Helper::SplitMix64(state);
+        keys.blackKingsideCastling = ChessEngine::Helper::SplitMix64(state);
+        keys.blackQueensideCastling = ChessEngine::Helper::SplitMix64(state);
+
+        for (auto& key : keys.enPassant)
+        {
+            key = ChessEngine::Helper::SplitMix64(state);
+        }
+
+        return keys;
+    }
 
-    bool AreRandomNumbersInitialized = false;
+    constexpr ZobristKeys Keys = CreateZobristKeys();
 }
 
 namespace ChessEngine
 {
     void BoardHasher::SetHash(const Board& board)
     {
-        InitializeRandomNumbers();
-
         m_hash = 0;
 
         const PieceArray& pieces = board.GetPieces();
         for (Square square = 0; Helper::IsValidSquare(square); square++)
         {
-            Piece piece = pieces[square];
-
-            if (piece.IsWhite())
-            {
-                m_hash ^= WhitePieceRandNums[piece.GetType()][square];
-            }
-            else
-            {
-                m_hash ^= BlackPieceRandNums[piece.GetType()][square];
-            }
+            m_hash ^= Keys.pieces[pieces[square].GetIndex()][square];
         }
 
         if (board.GetEnPassant().has_value())
         {
-            Row enPassantRow = Helper::RowFromSquare(board.GetEnPassant().value());
-            m_hash ^= EnPassantRandNums[enPassantRow];
+            Col enPassantCol = Helper::ColFromSquare(board.GetEnPassant().value());
+            m_hash ^= Keys.enPassant[enPassantCol];
         }
 
         if (board.CanWhiteCastleKingside())
         {
-            m_hash ^= WhiteKingsideCastlingRandNum;
+            m_hash ^= Keys.whiteKingsideCastling;
         }
         if (board.CanWhiteCastleQueenside())
         {
-            m_hash ^= WhiteQueensideCastlingRandNum;
+            m_hash ^= Keys.whiteQueensideCastling;
         }
         if (board.CanBlackCastleKingside())
         {
-            m_hash ^= BlackKingsideCastlingRandNum;
+            m_hash ^= Keys.blackKingsideCastling;
         }
         if (board.CanBlackCastleQueenside())
         {
-            m_hash ^= BlackQueensideCastlingRandNum;
+            m_hash ^= Keys.blackQueensideCastling;
         }
 
         if (board.GetWhiteToPlay())
         {
-            m_hash ^= WhiteToPlayRandNum;
+            m_hash ^= Keys.whiteToPlay;
         }
     }
 
     void BoardHasher::UpdatePiece(const Square square, const Piece oldPiece, const Piece newPiece)
     {
-        m_hash ^= (oldPiece.IsWhite() ? WhitePieceRandNums : BlackPieceRandNums)[oldPiece.GetType()][square];
-        m_hash ^= (newPiece.IsWhite() ? WhitePieceRandNums : BlackPieceRandNums)[newPiece.GetType()][square];
+        m_hash ^= Keys.pieces[oldPiece.GetIndex()][square];
+        m_hash ^= Keys.pieces[newPiece.GetIndex()][square];
     }
 
     void BoardHasher::UpdateEnPassant(const EnPassant& oldEnPassant, const EnPassant& newEnPassant)
     {
         if (oldEnPassant.has_value())
         {
-            m_hash ^= EnPassantRandNums[Helper::ColFromSquare(oldEnPassant.value())];
+            m_hash ^= Keys.enPassant[Helper::ColFromSquare(oldEnPassant.value())];
         }
 
         if (newEnPassant.has_value())
         {
-            m_hash ^= EnPassantRandNums[Helper::ColFromSquare(newEnPassant.value())];
+            m_hash ^= Keys.enPassant[Helper::ColFromSquare(newEnPassant.value())];
         }
     }
 
@@ -99,7 +131,7 @@ namespace ChessEngine
     {
         if (oldCastlingRights != newCastlingRights)
         {
-            m_hash ^= WhiteKingsideCastlingRandNum;
+            m_hash ^= Keys.whiteKingsideCastling;
         }
     }
 
@@ -107,7 +139,7 @@ namespace ChessEngine
     {
         if (oldCastlingRights != newCastlingRights)
         {
-            m_hash ^= WhiteQueensideCastlingRandNum;
+            m_hash ^= Keys.whiteQueensideCastling;
         }
     }
 
@@ -115,7 +147,7 @@ namespace ChessEngine
     {
         if (oldCastlingRights != newCastlingRights)
         {
-            m_hash ^= BlackKingsideCastlingRandNum;
+            m_hash ^= Keys.blackKingsideCastling;
         }
     }
 
@@ -123,7 +155,7 @@ namespace ChessEngine
     {
         if (oldCastlingRights != newCastlingRights)
         {
-            m_hash ^= BlackQueensideCastlingRandNum;
+            m_hash ^= Keys.blackQueensideCastling;
         }
     }
 
@@ -131,45 +163,7 @@ namespace ChessEngine
     {
         if (oldWhiteToPlay != newWhiteToPlay)
         {
-            m_hash ^= WhiteToPlayRandNum;
-        }
-    }
-
-    void BoardHasher::InitializeRandomNumbers(unsigned int seed)
-    {
-        // Prevent initializing the random numbers more than once
-        if (AreRandomNumbersInitialized)
-        {
-            return;
+            m_hash ^= Keys.whiteToPlay;
         }
-
-        srand(seed);
-
-        for (const auto& type : Piece::AllTypes)
-        {
-            if (type == Piece::Type::Empty)
-            {
-                WhitePieceRandNums[type] = Helper::CreateZeroArray<64>();
-                BlackPieceRandNums[type] = Helper::CreateZeroArray<64>();
-            }
-
-            WhitePieceRandNums[type] = Helper::CreateRandomArray<64>();
-            BlackPieceRandNums[type] = Helper::CreateRandomArray<64>();
-        }
-
-        // TODO - This is currently broken, rand() only returns an integer value
-        // in the range [0, 2^16) which will result in an incredible number of
-        // collisions when each board state is hashed into this range.
-        // The hashes should probably be 64-bit, apparently this is the standard.
-        WhiteToPlayRandNum = static_cast<unsigned int>(rand());
-        WhiteKingsideCastlingRandNum = static_cast<unsigned int>(rand());
-        WhiteQueensideCastlingRandNum = static_cast<unsigned int>(rand());
-        BlackKingsideCastlingRandNum = static_cast<unsigned int>(rand());
-        BlackQueensideCastlingRandNum = static_cast<unsigned int>(rand());
-
-        EnPassantRandNums = Helper::CreateRandomArray<8>();
-
-        // Prevent initializing the random numbers more than once
-        AreRandomNumbersInitialized = true;
     }
 }
@@ -12,7 +12,7 @@ namespace ChessEngine
         void SetHash(const Board& board);
 
         // Get the hash of the board this board hasher belongs to
-        unsigned int GetHash() const { return m_hash; }
+        uint64_t GetHash() const { return m_hash; }
 
         // Update the hash by settign the piece at a given square
         void UpdatePiece(const Square square, const Piece oldPiece, const Piece newPiece);
@@ -37,10 +37,7 @@ namespace ChessEngine
 
     private:
 
-        // Initialize the random numbers used for zobrist hashing
-        static void InitializeRandomNumbers(unsigned int seed = 0);
-
-        unsigned int m_hash = 0;    // The hash of the board that this board hasher belongs to
+        uint64_t m_hash = 0;    // The hash of the board that this board hasher belongs to
     };
 }
 
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <array>
-#include <list>
+#include <cstdint>
 #include <optional>
 
 namespace ChessEngine
@@ -10,6 +10,7 @@ namespace ChessEngine
     class Move;
     class MoveGenerator;
     class MoveInverse;
+    class MoveList;
     class Piece;
 
     // TODO - Consider removing these, they obfuscate the code somewhat with no real benefit.
@@ -21,8 +22,8 @@ namespace ChessEngine
 
     using PieceArray = std::array<Piece, 64>;
 
-    // TODO - Consider removing this, it obfuscates the code somewhat with no real benefit.
-    using MoveList = std::list<Move>;
+    // A 64-bit set of squares, bit N is set when square N is in the set
+    using Bitboard = uint64_t;
 
     // TODO - Consider removing this, it obfuscates the code somewhat with no real benefit.
     using EnPassant = std::optional<Square>;
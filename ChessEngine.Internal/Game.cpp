@@ -28,7 +28,10 @@ namespace ChessEngine
 
         while (true)
         {
-            if (m_isComputerWhite == m_board.GetWhiteToPlay())
+            const bool isWhite = m_board.GetWhiteToPlay();
+            const auto moveStart = std::chrono::steady_clock::now();
+
+            if (m_isComputerWhite == isWhite)
             {
                 const Move move = *GetComputerMove();
                 m_board.MakeMove(move);
@@ -47,12 +50,27 @@ namespace ChessEngine
 
                 m_board.MakeMove(move);
             }
+
+            UpdateClock(isWhite, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - moveStart));
         }
     }
 
     std::optional<Move> Game::GetComputerMove()
     {
-        return m_search.SearchPosition(m_board, 7).first;
+        SearchLimits limits;
+        limits.whiteTime = m_whiteTime;
+        limits.blackTime = m_blackTime;
+        limits.whiteIncrement = Increment;
+        limits.blackIncrement = Increment;
+
+        return m_search.SearchPosition(m_board, limits).first;
+    }
+
+    void Game::UpdateClock(const bool isWhite, const std::chrono::milliseconds elapsed)
+    {
+        std::chrono::milliseconds& time = (isWhite ? m_whiteTime : m_blackTime);
+
+        time = std::max(time - elapsed, std::chrono::milliseconds(0)) + Increment;
     }
 
     std::optional<Move> Game::GetPlayerMove()
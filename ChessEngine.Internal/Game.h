@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include "AsciiUI.h"
 #include "Board.h"
 #include "Search.h"
@@ -10,6 +12,9 @@ namespace ChessEngine
     {
     public:
 
+        constexpr static std::chrono::milliseconds StartingTime{ 5 * 60 * 1000 };  // The time each player starts with on their clock
+        constexpr static std::chrono::milliseconds Increment{ 3 * 1000 };          // The time added to a player's clock after each move
+
         // Start the game, get player options (colour to play, etc.) then enter game loop
         void StartGame();
 
@@ -21,10 +26,16 @@ namespace ChessEngine
         // Get the player's move for this turn
         std::optional<Move> GetPlayerMove();
 
+        // Update the clock of the player who just moved, given how long they took
+        void UpdateClock(const bool isWhite, const std::chrono::milliseconds elapsed);
+
         bool m_isPlayerQuitting = false;    // Whether the player is in the act of quitting the game
 
         bool m_isComputerWhite; // Whether the computer is playing white or not
 
+        std::chrono::milliseconds m_whiteTime = StartingTime;  // The time white has left on their clock
+        std::chrono::milliseconds m_blackTime = StartingTime;  // The time black has left on their clock
+
         Board  m_board;     // The current board for this game
         Search m_search;    // The current search for this game
 
@@ -2,6 +2,10 @@
 
 #include "Definitions.h"
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace ChessEngine
 {
     namespace Helper
@@ -30,6 +34,39 @@ namespace ChessEngine
         // Get whether a square is white given the index of the square
         inline bool IsSquareWhite(const Square s) { return IsSquareWhite(RowFromSquare(s), ColFromSquare(s)); }
 
+        // Get the bitboard with only the given square set
+        constexpr Bitboard SquareBitboard(const Square s) { return (1ULL << s); }
+
+        // Get the number of squares set in a bitboard
+        inline int PopCount(const Bitboard b)
+        {
+#if defined(_MSC_VER)
+            return static_cast<int>(__popcnt64(b));
+#else
+            return __builtin_popcountll(b);
+#endif
+        }
+
+        // Get the lowest square set in a bitboard (the bitboard must not be empty)
+        inline Square BitScanForward(const Bitboard b)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward64(&index, b);
+            return static_cast<Square>(index);
+#else
+            return static_cast<Square>(__builtin_ctzll(b));
+#endif
+        }
+
+        // Remove the lowest square set in a bitboard and return it (the bitboard must not be empty)
+        inline Square PopLowestSquare(Bitboard& b)
+        {
+            const Square s = BitScanForward(b);
+            b &= (b - 1);
+            return s;
+        }
+
         // Get the square from a string (ex. h8 -> 63)
         Square SquareFromString(const std::string& s);
 
@@ -39,30 +76,14 @@ namespace ChessEngine
         // Convert a std::string to a std::wstring
         std::wstring StringToWString(const std::string& s);
 
-        // Create an array with all zero entries
-        template<unsigned int N> std::array<unsigned int, N> CreateZeroArray()
+        // Get the next number from a splitmix64 pseudo-random number generator with the given state (advancing the state)
+        // This is used rather than rand() as the values are 64-bit and are the same on every platform for a given seed.
+        constexpr uint64_t SplitMix64(uint64_t& state)
         {
-            std::array<unsigned int, N> arr;
-
-            for (auto& number : arr)
-                number = 0U;
-
-            return arr;
-        }
-
-        // Create an array with random entries
-        template<unsigned int N> std::array<unsigned int, N> CreateRandomArray()
-        {
-            std::array<unsigned int, N> arr;
-
-            for (auto& number : arr)
-                // TODO - This is currently broken, rand() only returns an integer value
-                // in the range [0, 2^16) which will result in an incredible number of
-                // collisions when each board state is hashed into this range.
-                // The hashes should probably be 64-bit, apparently this is the standard.
-                number = static_cast<unsigned int>(rand());
-
-            return arr;
+            uint64_t z = (state += 0x9E37'79B9'7F4A'7C15);
+            z = (z ^ (z >> 30)) * 0xBF58'476D'1CE4'E5B9;
+            z = (z ^ (z >> 27)) * 0x94D0'49BB'1331'11EB;
+            return z ^ (z >> 31);
         }
     }
 }
@@ -113,4 +113,16 @@ namespace ChessEngine
     {
         return ("(" + std::to_string(m_move) + "," + Helper::StringFromSquare(GetInitSquare()) + "," + Helper::StringFromSquare(GetDestSquare()) + ")");
     }
+
+    std::string Move::GetLongAlgebraicString() const
+    {
+        std::string moveStr = Helper::StringFromSquare(GetInitSquare()) + Helper::StringFromSquare(GetDestSquare());
+
+        if (IsPromotion())
+        {
+            moveStr += Piece(GetPromotionType(), false).GetAscii();
+        }
+
+        return moveStr;
+    }
 }
\ No newline at end of file
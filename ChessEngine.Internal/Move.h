@@ -91,6 +91,9 @@ namespace ChessEngine
         // Get the move represented as a string (raw value, start square, end square)
         std::string GetStringExtended() const;
 
+        // Get the move represented as a string in long algebraic notation (ex. e2e4 or e7e8q)
+        std::string GetLongAlgebraicString() const;
+
     private:
         // Helper function for querying whether a move is XXX (capture, promotion, etc.)
         bool IsSpecial(Special specialType) const { return (Special(m_move & TypeMask) == specialType); }
@@ -104,7 +107,7 @@ namespace ChessEngine
 
         const static unsigned short Capture = 0b0100;   // The bitmap for whether a move is a capture
 
-        const unsigned short Promotion = 0b1000;        // The bitmap for whether a move is a promotion
+        const static unsigned short Promotion = 0b1000; // The bitmap for whether a move is a promotion
 
         unsigned short m_move = 0;  // The underlying bitmap for the move
     };
@@ -2,77 +2,18 @@
 
 #include "MoveGenerator.h"
 
+#include "Attacks.h"
 #include "Board.h"
 #include "Definitions.h"
 #include "Helper.h"
 #include "Move.h"
+#include "MoveList.h"
 #include "Piece.h"
 
 namespace ChessEngine
 {
     namespace
     {
-        // The offsets from a square to all those whigh can be reached via a knight jump
-        constexpr char KnightJumps[8] = { +8, -8, +12, -12, +19, -19, +21, -21 };
-
-        // The offsets from a square to those adjacent diagonally
-        constexpr char Diagonals[4] = { +9, -9, +11, -11 };
-
-        // The offsets from a square to those adjacent along the rank or file
-        constexpr char RanksAndFiles[4] = { +1, -1, +10, -10 };
-
-        // The offsets from a square to those adjacent diagonally or along the rank or file
-        constexpr char DiagonalsRanksAndFiles[8] = { +9, -9, +11, -11, +1, -1, +10, -10 };
-
-        // The 120 character mailbox for detecting whether a move will land on
-        // the board or not. Each entry is either -1 denoting that the move is
-        // not on the board, or, the valid square that the move will land on.
-        constexpr char Mailbox120[120] = {
-            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-            -1,  0,  1,  2,  3,  4,  5,  6,  7, -1,
-            -1,  8,  9, 10, 11, 12, 13, 14, 15, -1,
-            -1, 16, 17, 18, 19, 20, 21, 22, 23, -1,
-            -1, 24, 25, 26, 27, 28, 29, 30, 31, -1,
-            -1, 32, 33, 34, 35, 36, 37, 38, 39, -1,
-            -1, 40, 41, 42, 43, 44, 45, 46, 47, -1,
-            -1, 48, 49, 50, 51, 52, 53, 54, 55, -1,
-            -1, 56, 57, 58, 59, 60, 61, 62, 63, -1,
-            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-        };
-
-        // The 64 character mailbox which maps squares to the index of the
-        // corresponding entry in Mailbox120.
-        constexpr char Mailbox64[64] = {
-            21, 22, 23, 24, 25, 26, 27, 28,
-            31, 32, 33, 34, 35, 36, 37, 38,
-            41, 42, 43, 44, 45, 46, 47, 48,
-            51, 52, 53, 54, 55, 56, 57, 58,
-            61, 62, 63, 64, 65, 66, 67, 68,
-            71, 72, 73, 74, 75, 76, 77, 78,
-            81, 82, 83, 84, 85, 86, 87, 88,
-            91, 92, 93, 94, 95, 96, 97, 98
-        };
-
-        // Helper function checking whether a given square plus an offset from that square is on the board, returning
-        // a boolean indicating whether it is or not, and setting the square passed as a reference if so.
-        bool CheckMoveLandsOnBoard(const Square init, const char offset, Square& dest)
-        {
-            const char destIndex120 = Mailbox64[init] + offset;
-            const char destIndex64 = Mailbox120[destIndex120];
-
-            if (destIndex64 == -1)
-            {
-                return false;
-            }
-            else
-            {
-                dest = Square(destIndex64);
-                return true;
-            }
-        }
-
         // Helper function returns the destination square which is the sum of a given initial square and offset.
         Square OffsetSquare(const Square init, const char offset)
         {
@@ -80,163 +21,277 @@ namespace ChessEngine
         }
     }
 
-    MoveList MoveGenerator::GenerateMoves(const Board& board)
+    MoveList MoveGenerator::GenerateMoves(const Board& board, const Mode mode)
     {
         MoveList moveList;
+        GenerateMoves(board, moveList, mode);
+
+        return moveList;
+    }
 
-        for (Square init = 0; Helper::IsValidSquare(init); init++)
+    void MoveGenerator::GenerateMoves(const Board& board, MoveList& moveList, const Mode mode)
+    {
+        LegalMoveInfo info = GetLegalMoveInfo(board);
+
+        info.capturesOnly = (mode == Mode::CapturesAndPromotions);
+
+        // Only visit the squares occupied by the player to move's pieces, when in double check only the king can move
+        Bitboard pieces = board.GetColourBitboard(board.GetWhiteToPlay());
+        if (Helper::PopCount(info.checkers) > 1)
         {
-            Piece piece = board.GetPieces()[init];
+            pieces &= board.GetBitboard(Piece::Type::King, board.GetWhiteToPlay());
+        }
 
-            if (piece.IsEmpty() || piece.IsWhite() != board.GetWhiteToPlay())
-            {
-                continue;
-            }
-            else if (piece.IsPawn())
+        while (pieces != 0)
+        {
+            const Square init = Helper::PopLowestSquare(pieces);
+            const Piece piece = board.GetPieces()[init];
+
+            if (piece.IsPawn())
             {
-                GeneratePawnMoves(moveList, board, init);
+                GeneratePawnMoves(moveList, board, init, info);
             }
             else if (piece.IsKnight())
             {
-                GenerateKnightMoves(moveList, board, init);
+                GenerateKnightMoves(moveList, board, init, info);
             }
             else if (piece.IsBishop())
             {
-                GenerateBishopMoves(moveList, board, init);
+                GenerateBishopMoves(moveList, board, init, info);
             }
             else if (piece.IsRook())
             {
-                GenerateRookMoves(moveList, board, init);
+                GenerateRookMoves(moveList, board, init, info);
             }
             else if (piece.IsQueen())
             {
-                GenerateQueenMoves(moveList, board, init);
+                GenerateQueenMoves(moveList, board, init, info);
             }
             else if (piece.IsKing())
             {
-                GenerateKingMoves(moveList, board, init);
+                GenerateKingMoves(moveList, board, init, info);
             }
         }
-
-        return moveList;
     }
 
     bool MoveGenerator::IsSquareAttacked(const Board& board, const Square init)
     {
-        // NOTE:
-        // A whole bunch of the conditionals here are relying upon their order. When calling
-        // CheckMoveLandsOnBoard this returns true if the move lands on the board but it
-        // also sets 'dest' to the square the move lands on if it does land on the board.
-        // 'dest' is subsequently used to check what piece is on that square. Thus
-        // CheckMoveLandsOnBoard must be the first check in these compound conditionals.
+        return (GetAttackers(board, init, board.GetOccupiedBitboard(), !board.GetWhiteToPlay()) != 0);
+    }
+
+    bool MoveGenerator::IsInCheck(const Board& board)
+    {
+        const Bitboard king = board.GetBitboard(Piece::Type::King, board.GetWhiteToPlay());
 
-        Square dest;
+        return (king != 0) && IsSquareAttacked(board, Helper::BitScanForward(king));
+    }
+
+    bool MoveGenerator::GivesCheck(const Board& board, const Move move)
+    {
+        const bool isWhite = board.GetWhiteToPlay();
+        const Bitboard king = board.GetBitboard(Piece::Type::King, !isWhite);
 
-        // Check knight jumps
-        for (auto offset : KnightJumps)
+        if (king == 0)
         {
-            if (CheckMoveLandsOnBoard(init, offset, dest))
-            {
-                const Piece piece = board.GetPieces()[dest];
+            return false;
+        }
 
-                if ((board.GetWhiteToPlay() && piece == Piece::bn) || 
-                    (!board.GetWhiteToPlay() && piece == Piece::wn))
-                {
-                    return true;
-                }
-            }
+        const Square kingSquare = Helper::BitScanForward(king);
+
+        // The piece which lands on the destination square, and (for castling) the rook which moves beside the king
+        Square init = move.GetInitSquare();
+        Square dest = move.GetDestSquare();
+        Piece::Type type = (move.IsPromotion() ? move.GetPromotionType() : board.GetPieces()[init].GetType());
+        Bitboard moved = Helper::SquareBitboard(init);
+        Bitboard occupied = board.GetOccupiedBitboard() ^ Helper::SquareBitboard(init);
+
+        if (move.IsKingsideCastles() || move.IsQueensideCastles())
+        {
+            occupied |= Helper::SquareBitboard(dest);
+
+            init = static_cast<Square>(move.IsKingsideCastles() ? init + 3 : init - 4);
+            dest = static_cast<Square>(move.IsKingsideCastles() ? dest - 1 : dest + 1);
+            type = Piece::Type::Rook;
+            moved |= Helper::SquareBitboard(init);
+            occupied ^= Helper::SquareBitboard(init);
+        }
+        else if (move.IsEnPassantCapture())
+        {
+            occupied ^= Helper::SquareBitboard(static_cast<Square>(isWhite ? dest - 8 : dest + 8));
         }
 
-        // Check diagonals for bishops, queens and king
-        for (auto offset : Diagonals)
+        occupied |= Helper::SquareBitboard(dest);
+
+        // A direct check from the piece which moved
+        Bitboard attacks = 0;
+        switch (type)
         {
-            for (char lineOffset = offset; CheckMoveLandsOnBoard(init, lineOffset, dest); lineOffset += offset)
-            {
-                const Piece piece = board.GetPieces()[dest];
+        case Piece::Type::Pawn:   attacks = Attacks::GetPawnAttacks(dest, isWhite);    break;
+        case Piece::Type::Knight: attacks = Attacks::GetKnightAttacks(dest);           break;
+        case Piece::Type::Bishop: attacks = Attacks::GetBishopAttacks(dest, occupied); break;
+        case Piece::Type::Rook:   attacks = Attacks::GetRookAttacks(dest, occupied);   break;
+        case Piece::Type::Queen:  attacks = Attacks::GetQueenAttacks(dest, occupied);  break;
+        default:                                                                       break;
+        }
 
-                if ((board.GetWhiteToPlay() && piece == Piece::bb) ||
-                    (board.GetWhiteToPlay() && piece == Piece::bq) ||
-                    (!board.GetWhiteToPlay() && piece == Piece::wb) ||
-                    (!board.GetWhiteToPlay() && piece == Piece::wq))
-                {
-                    return true;
-                }
-                else if (piece != Piece::ee)
-                {
-                    break;
-                }
-            }
+        if (attacks & king)
+        {
+            return true;
+        }
 
-            if (CheckMoveLandsOnBoard(init, offset, dest) &&
-                ((board.GetWhiteToPlay() && board.GetPieces()[dest] == Piece::bk) || 
-                (!board.GetWhiteToPlay() && board.GetPieces()[dest] == Piece::wk)))
-            {
-                return true;
-            }
+        // A discovered check from a sliding piece which the move uncovered (the pieces which moved are excluded,
+        // as the attackers are found from their squares before the move)
+        return ((GetAttackers(board, kingSquare, occupied, isWhite) & ~moved) != 0);
+    }
+
+    Bitboard MoveGenerator::GetAttackers(const Board& board, const Square square, const Bitboard occupied, const bool isWhite)
+    {
+        // A square is attacked by a piece iff a piece of the same type on the square would attack that piece, so
+        // look up the attacks from the square for each type of piece and intersect them with the attacker's pieces
+        // of that type. For pawns this means using the attacks of a pawn belonging to the other player.
+
+        const Bitboard queens = board.GetBitboard(Piece::Type::Queen, isWhite);
+
+        return (
+            (Attacks::GetPawnAttacks(square, !isWhite) & board.GetBitboard(Piece::Type::Pawn, isWhite)) |
+            (Attacks::GetKnightAttacks(square) & board.GetBitboard(Piece::Type::Knight, isWhite)) |
+            (Attacks::GetKingAttacks(square) & board.GetBitboard(Piece::Type::King, isWhite)) |
+            (Attacks::GetBishopAttacks(square, occupied) & (board.GetBitboard(Piece::Type::Bishop, isWhite) | queens)) |
+            (Attacks::GetRookAttacks(square, occupied) & (board.GetBitboard(Piece::Type::Rook, isWhite) | queens)));
+    }
+
+    MoveGenerator::LegalMoveInfo MoveGenerator::GetLegalMoveInfo(const Board& board)
+    {
+        LegalMoveInfo info;
+
+        const bool isWhite = board.GetWhiteToPlay();
+        const Bitboard king = board.GetBitboard(Piece::Type::King, isWhite);
+
+        // Without a king (only in contrived test positions) every pseudo-legal move is legal
+        if (king == 0)
+        {
+            return info;
         }
 
-        // Check diagonals for pawns
-        if (board.GetWhiteToPlay())
+        const Square kingSquare = Helper::BitScanForward(king);
+        const Bitboard occupied = board.GetOccupiedBitboard();
+
+        info.kingSquare = kingSquare;
+        info.checkers = GetAttackers(board, kingSquare, occupied, !isWhite);
+
+        // The king is removed from the board when finding the attacked squares, so that it can't
+        // escape a check from a sliding piece by stepping back along the line of the check
+        info.attacked = GetAttackedSquares(board, !isWhite, occupied ^ king);
+
+        // A piece is pinned if it is the only piece between the king and an opponent's sliding piece on the same line
+        const Bitboard queens = board.GetBitboard(Piece::Type::Queen, !isWhite);
+        Bitboard snipers = (
+            (Attacks::GetBishopAttacks(kingSquare, 0) & (board.GetBitboard(Piece::Type::Bishop, !isWhite) | queens)) |
+            (Attacks::GetRookAttacks(kingSquare, 0) & (board.GetBitboard(Piece::Type::Rook, !isWhite) | queens)));
+
+        while (snipers != 0)
         {
-            if ((CheckMoveLandsOnBoard(init, 9, dest) && (board.GetPieces()[dest] == Piece::bp)) ||
-                (CheckMoveLandsOnBoard(init, 11, dest) && (board.GetPieces()[dest] == Piece::bp)))
+            const Bitboard blockers = Attacks::GetBetween(kingSquare, Helper::PopLowestSquare(snipers)) & occupied;
+
+            if (Helper::PopCount(blockers) == 1 && (blockers & board.GetColourBitboard(isWhite)))
             {
-                return true;
+                info.pinned |= blockers;
             }
         }
-        else
+
+        // When in check from a single piece other pieces must capture it or block the check
+        if (Helper::PopCount(info.checkers) == 1)
         {
-            if ((CheckMoveLandsOnBoard(init, -9, dest) && (board.GetPieces()[dest] == Piece::wp)) ||
-                (CheckMoveLandsOnBoard(init, -11, dest) && (board.GetPieces()[dest] == Piece::wp)))
-            {
-                return true;
-            }
+            info.targets = info.checkers | Attacks::GetBetween(kingSquare, Helper::BitScanForward(info.checkers));
         }
 
-        // Check ranks and files for rooks, queens and king
-        for (auto offset : RanksAndFiles)
+        return info;
+    }
+
+    Bitboard MoveGenerator::GetLegalSquares(const LegalMoveInfo& info, const Square init)
+    {
+        // A pinned piece may only move along the line between the king and the piece pinning it
+        if (info.pinned & Helper::SquareBitboard(init))
         {
-            for (char lineOffset = offset; CheckMoveLandsOnBoard(init, lineOffset, dest); lineOffset += offset)
-            {
-                const Piece piece = board.GetPieces()[dest];
+            return info.targets & Attacks::GetLine(*info.kingSquare, init);
+        }
 
-                if ((board.GetWhiteToPlay() && piece == Piece::br) ||
-                    (board.GetWhiteToPlay() && piece == Piece::bq) ||
-                    (!board.GetWhiteToPlay() && piece == Piece::wr) ||
-                    (!board.GetWhiteToPlay() && piece == Piece::wq))
-                {
-                    return true;
-                }
-                else if (piece != Piece::ee)
-                {
-                    break;
-                }
-            }
+        return info.targets;
+    }
 
-            if (CheckMoveLandsOnBoard(init, offset, dest) &&
-                ((board.GetWhiteToPlay() && board.GetPieces()[dest] == Piece::bk) ||
-                (!board.GetWhiteToPlay() && board.GetPieces()[dest] == Piece::wk)))
+    Bitboard MoveGenerator::GetAttackedSquares(const Board& board, const bool isWhite, const Bitboard occupied)
+    {
+        Bitboard attacked = 0;
+
+        for (Bitboard pieces = board.GetColourBitboard(isWhite); pieces != 0;)
+        {
+            const Square square = Helper::PopLowestSquare(pieces);
+            const Piece piece = board.GetPieces()[square];
+
+            if (piece.IsPawn())
             {
-                return true;
+                attacked |= Attacks::GetPawnAttacks(square, isWhite);
             }
+            else if (piece.IsKnight())
+            {
+                attacked |= Attacks::GetKnightAttacks(square);
+            }
+            else if (piece.IsBishop())
+            {
+                attacked |= Attacks::GetBishopAttacks(square, occupied);
+            }
+            else if (piece.IsRook())
+            {
+                attacked |= Attacks::GetRookAttacks(square, occupied);
+            }
+            else if (piece.IsQueen())
+            {
+                attacked |= Attacks::GetQueenAttacks(square, occupied);
+            }
+            else if (piece.IsKing())
+            {
+                attacked |= Attacks::GetKingAttacks(square);
+            }
+        }
+
+        return attacked;
+    }
+
+    bool MoveGenerator::IsEnPassantLegal(const Board& board, const LegalMoveInfo& info, const Square init, const Square dest)
+    {
+        if (!info.kingSquare)
+        {
+            return true;
         }
 
-        return false;
+        // En passant removes two pieces from the same rank at once (which can expose the king along the rank), and
+        // can resolve a check by capturing the pawn which was just pushed without landing on its square, so rather
+        // than using the pins and targets just check whether the king is attacked after making the capture.
+
+        const bool isWhite = board.GetWhiteToPlay();
+        const Bitboard captured = Helper::SquareBitboard(OffsetSquare(dest, (isWhite ? -8 : +8)));
+        const Bitboard occupied = (board.GetOccupiedBitboard() ^ Helper::SquareBitboard(init) ^ captured) | Helper::SquareBitboard(dest);
+
+        return ((GetAttackers(board, *info.kingSquare, occupied, !isWhite) & ~captured) == 0);
     }
 
-    void MoveGenerator::GeneratePawnMoves(MoveList& moveList, const Board& board, const Square init)
+    void MoveGenerator::GeneratePawnMoves(MoveList& moveList, const Board& board, const Square init, const LegalMoveInfo& info)
     {
+        const bool isWhite = board.GetWhiteToPlay();
+
         const Row row = Helper::RowFromSquare(init);
-        const bool onPlayersRank2 = ((board.GetWhiteToPlay() && row == 1) || (!board.GetWhiteToPlay() && row == 6));
-        const bool onPlayersRank7 = ((board.GetWhiteToPlay() && row == 6) || (!board.GetWhiteToPlay() && row == 1));
+        const bool onPlayersRank2 = ((isWhite && row == 1) || (!isWhite && row == 6));
+        const bool onPlayersRank7 = ((isWhite && row == 6) || (!isWhite && row == 1));
+
+        const Bitboard legalSquares = GetLegalSquares(info, init);
+        const Bitboard emptySquares = ~board.GetOccupiedBitboard();
 
         // Pushing one or two squares forwards, we don't need to check that these are on the board
-        const Square oneForward = OffsetSquare(init, (board.GetWhiteToPlay() ? +8 : -8));
-        const Square twoForward = OffsetSquare(init, (board.GetWhiteToPlay() ? +16 : -16));
+        const Square oneForward = OffsetSquare(init, (isWhite ? +8 : -8));
+        const Square twoForward = OffsetSquare(init, (isWhite ? +16 : -16));
 
-        // Capturing left and right offsets, used to check whether these captures are on the board
-        const char captureLftOffset = (board.GetWhiteToPlay() ? +9 : -9);
-        const char captureRgtOffset = (board.GetWhiteToPlay() ? +11 : -11);
+        // Capturing diagonally forwards
+        Bitboard captures = Attacks::GetPawnAttacks(init, isWhite) & board.GetColourBitboard(!isWhite) & legalSquares;
 
         // Handle promotions
         if (onPlayersRank7)
@@ -250,214 +305,127 @@ namespace ChessEngine
             };
 
             // Push one square
-            if (board.GetPieces()[oneForward] == Piece::ee)
+            if (emptySquares & legalSquares & Helper::SquareBitboard(oneForward))
             {
                 addPromotionsToList(oneForward, false);
             }
 
-            Square dest;
-
-            // Take left
-            if (CheckMoveLandsOnBoard(init, captureLftOffset, dest))
+            // Take left and right
+            while (captures != 0)
             {
-                const Piece piece = board.GetPieces()[dest];
-
-                if ((piece != Piece::ee) && (piece.IsWhite() != board.GetWhiteToPlay()))
-                {
-                    addPromotionsToList(dest, true);
-                }
-            }
-
-            // Take right
-            if (CheckMoveLandsOnBoard(init, captureRgtOffset, dest))
-            {
-                const Piece piece = board.GetPieces()[dest];
-
-                if ((piece != Piece::ee) && (piece.IsWhite() != board.GetWhiteToPlay()))
-                {
-                    addPromotionsToList(dest, true);
-                }
+                addPromotionsToList(Helper::PopLowestSquare(captures), true);
             }
         }
         else
         {
-            // Push one square
-            if (board.GetPieces()[oneForward] == Piece::ee)
+            // Push one square (these are quiet so aren't generated when only generating captures and promotions)
+            if (!info.capturesOnly && (emptySquares & Helper::SquareBitboard(oneForward)))
             {
-                moveList.push_back(Move(init, oneForward));
+                if (legalSquares & Helper::SquareBitboard(oneForward))
+                {
+                    moveList.push_back(Move(init, oneForward));
+                }
 
                 // Push two squares
-                if (onPlayersRank2 && board.GetPieces()[twoForward] == Piece::ee)
+                if (onPlayersRank2 && (emptySquares & legalSquares & Helper::SquareBitboard(twoForward)))
                 {
                     moveList.push_back(Move(init, twoForward, Move::Special::DoublePawnPush));
                 }
             }
 
-            Square dest;
-
-            // Take left
-            if (CheckMoveLandsOnBoard(init, captureLftOffset, dest))
+            // Take left and right
+            while (captures != 0)
             {
-                const Piece piece = board.GetPieces()[dest];
-
-                if ((piece != Piece::ee) && (piece.IsWhite() != board.GetWhiteToPlay()))
-                {
-                    moveList.push_back(Move(init, dest, true));
-                }
-                else if (dest == board.GetEnPassant())
-                {
-                    moveList.push_back(Move(init, dest, Move::Special::EnPassantCapture));
-                }
+                moveList.push_back(Move(init, Helper::PopLowestSquare(captures), true));
             }
 
-            // Take right
-            if (CheckMoveLandsOnBoard(init, captureRgtOffset, dest))
+            // Take en passant
+            if (const auto& enPassant = board.GetEnPassant())
             {
-                const Piece piece = board.GetPieces()[dest];
-
-                if ((piece != Piece::ee) && (piece.IsWhite() != board.GetWhiteToPlay()))
-                {
-                    moveList.push_back(Move(init, dest, true));
-                }
-                else if (dest == board.GetEnPassant())
+                if ((Attacks::GetPawnAttacks(init, isWhite) & Helper::SquareBitboard(*enPassant)) &&
+                    IsEnPassantLegal(board, info, init, *enPassant))
                 {
-                    moveList.push_back(Move(init, dest, Move::Special::EnPassantCapture));
+                    moveList.push_back(Move(init, *enPassant, Move::Special::EnPassantCapture));
                 }
             }
         }
     }
 
-    void MoveGenerator::GenerateKnightMoves(MoveList& moveList, const Board& board, const Square init)
+    void MoveGenerator::GenerateKnightMoves(MoveList& moveList, const Board& board, const Square init, const LegalMoveInfo& info)
     {
-        for (auto offset : KnightJumps)
-        {
-            Square dest;
-
-            if (CheckMoveLandsOnBoard(init, offset, dest))
-            {
-                if (board.GetPieces()[dest] == Piece::ee)
-                {
-                    // Move is not a capture
-                    moveList.push_back(Move(init, dest));
-                }
-                else if (board.GetPieces()[dest].IsWhite() != board.GetWhiteToPlay())
-                {
-                    // Move is a capture
-                    moveList.push_back(Move(init, dest, true));
-                }
-            }
-        }
+        GenerateMovesToSquares(moveList, board, init, Attacks::GetKnightAttacks(init) & GetLegalSquares(info, init), info);
     }
 
-    void MoveGenerator::GenerateBishopMoves(MoveList& moveList, const Board& board, const Square init)
+    void MoveGenerator::GenerateBishopMoves(MoveList& moveList, const Board& board, const Square init, const LegalMoveInfo& info)
     {
-        for (auto lineOffset : Diagonals)
-        {
-            GenerateMovesAlongLine(moveList, board, init, lineOffset);
-        }
+        GenerateMovesToSquares(moveList, board, init, Attacks::GetBishopAttacks(init, board.GetOccupiedBitboard()) & GetLegalSquares(info, init), info);
     }
 
-    void MoveGenerator::GenerateRookMoves(MoveList& moveList, const Board& board, const Square init)
+    void MoveGenerator::GenerateRookMoves(MoveList& moveList, const Board& board, const Square init, const LegalMoveInfo& info)
     {
-        for (auto lineOffset : RanksAndFiles)
-        {
-            GenerateMovesAlongLine(moveList, board, init, lineOffset);
-        }
+        GenerateMovesToSquares(moveList, board, init, Attacks::GetRookAttacks(init, board.GetOccupiedBitboard()) & GetLegalSquares(info, init), info);
     }
 
-    void MoveGenerator::GenerateQueenMoves(MoveList& moveList, const Board& board, const Square init)
+    void MoveGenerator::GenerateQueenMoves(MoveList& moveList, const Board& board, const Square init, const LegalMoveInfo& info)
     {
-        for (auto lineOffset : DiagonalsRanksAndFiles)
-        {
-            GenerateMovesAlongLine(moveList, board, init, lineOffset);
-        }
+        GenerateMovesToSquares(moveList, board, init, Attacks::GetQueenAttacks(init, board.GetOccupiedBitboard()) & GetLegalSquares(info, init), info);
     }
 
-    void MoveGenerator::GenerateKingMoves(MoveList& moveList, const Board& board, const Square init)
+    void MoveGenerator::GenerateKingMoves(MoveList& moveList, const Board& board, const Square init, const LegalMoveInfo& info)
     {
-        Square dest;
+        // Check for regular (quiet and capture) moves 1 square along each diagonal, rank and file which are not attacked
+        GenerateMovesToSquares(moveList, board, init, Attacks::GetKingAttacks(init) & ~info.attacked, info);
+
+        // Check for castling moves
 
-        // Check for regular (quiet and capture) moves 1 square along each diagonal, rank and file
-        for (char offset : DiagonalsRanksAndFiles)
+        if (info.checkers != 0 || info.capturesOnly)
         {
-            if (CheckMoveLandsOnBoard(init, offset, dest))
-            {
-                if (board.GetPieces()[dest] == Piece::ee)
-                {
-                    // Move is not a capture
-                    moveList.push_back(Move(init, dest));
-                }
-                else if (board.GetPieces()[dest].IsWhite() != board.GetWhiteToPlay())
-                {
-                    // Move is a capture
-                    moveList.push_back(Move(init, dest, true));
-                }
-            }
+            return;
         }
 
-        // Check for castling moves
-
         const bool canCastleKingside = (board.GetWhiteToPlay() ? board.CanWhiteCastleKingside() : board.CanBlackCastleKingside());
         const bool canCastleQueenside = (board.GetWhiteToPlay() ? board.CanWhiteCastleQueenside() : board.CanBlackCastleQueenside());
 
         const Square kingPosition = (board.GetWhiteToPlay() ? Helper::SquareFromRowAndCol(0, 4) : Helper::SquareFromRowAndCol(7, 4));
 
-        if (IsSquareAttacked(board, kingPosition))
-        {
-            return;
-        }
+        const Bitboard occupied = board.GetOccupiedBitboard();
 
         if (canCastleKingside)
         {
-            const Square oneKingside = OffsetSquare(kingPosition, 1);
-            const Square twoKingside = OffsetSquare(kingPosition, 2);
+            const Bitboard oneKingside = Helper::SquareBitboard(OffsetSquare(kingPosition, 1));
+            const Bitboard twoKingside = Helper::SquareBitboard(OffsetSquare(kingPosition, 2));
 
-            if (((board.GetPieces()[oneKingside] == Piece::ee) && !IsSquareAttacked(board, oneKingside)) &&
-                ((board.GetPieces()[twoKingside] == Piece::ee) && !IsSquareAttacked(board, twoKingside)))
+            if (((oneKingside | twoKingside) & (occupied | info.attacked)) == 0)
             {
-                moveList.push_back(Move(kingPosition, twoKingside, Move::Special::KingsideCastles));
+                moveList.push_back(Move(kingPosition, OffsetSquare(kingPosition, 2), Move::Special::KingsideCastles));
             }
         }
 
         if (canCastleQueenside)
         {
-            const Square oneQueenside = OffsetSquare(kingPosition, -1);
-            const Square twoQueenside = OffsetSquare(kingPosition, -2);
-            const Square threeQueenside = OffsetSquare(kingPosition, -3);
+            const Bitboard oneQueenside = Helper::SquareBitboard(OffsetSquare(kingPosition, -1));
+            const Bitboard twoQueenside = Helper::SquareBitboard(OffsetSquare(kingPosition, -2));
+            const Bitboard threeQueenside = Helper::SquareBitboard(OffsetSquare(kingPosition, -3));
 
-            if (((board.GetPieces()[oneQueenside] == Piece::ee) && !IsSquareAttacked(board, oneQueenside)) &&
-                ((board.GetPieces()[twoQueenside] == Piece::ee) && !IsSquareAttacked(board, twoQueenside)) &&
-                ((board.GetPieces()[threeQueenside] == Piece::ee)))
+            if ((((oneQueenside | twoQueenside) & (occupied | info.attacked)) == 0) && ((threeQueenside & occupied) == 0))
             {
-                moveList.push_back(Move(kingPosition, twoQueenside, Move::Special::QueensideCastles));
+                moveList.push_back(Move(kingPosition, OffsetSquare(kingPosition, -2), Move::Special::QueensideCastles));
             }
         }
     }
 
-    void MoveGenerator::GenerateMovesAlongLine(MoveList& moveList, const Board& board, const Square init, const char lineOffset)
+    void MoveGenerator::GenerateMovesToSquares(MoveList& moveList, const Board& board, const Square init, const Bitboard squares, const LegalMoveInfo& info)
     {
-        // Search each square along the given line (diagonal, rank or file) starting at init until either the next square
-        // is off the board or the next square is occupied. If the next square is occupied check whether we can capture.
-        
-        Square dest;
+        // Exclude the squares occupied by the player's own pieces, a move to any other square is a capture iff it is occupied
+
+        const Bitboard opponentPieces = board.GetColourBitboard(!board.GetWhiteToPlay());
+        const Bitboard emptySquares = (info.capturesOnly ? 0 : ~board.GetOccupiedBitboard());
 
-        for (char offset = lineOffset; CheckMoveLandsOnBoard(init, offset, dest); offset += lineOffset)
+        for (Bitboard dests = squares & (opponentPieces | emptySquares); dests != 0;)
         {
-            if (board.GetPieces()[dest] == Piece::ee)
-            {
-                // Move is not a capture
-                moveList.push_back(Move(init, dest));
-            }
-            else
-            {
-                if (board.GetPieces()[dest].IsWhite() != board.GetWhiteToPlay())
-                {
-                    // Move is a capture
-                    moveList.push_back(Move(init, dest, true));
-                }
-                
-                break;
-            }
+            const Square dest = Helper::PopLowestSquare(dests);
+
+            moveList.push_back(Move(init, dest, (opponentPieces & Helper::SquareBitboard(dest)) != 0));
         }
     }
-}
\ No newline at end of file
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Definitions.h"
+#include "MoveList.h"
 
 namespace ChessEngine
 {
@@ -10,33 +11,76 @@ namespace ChessEngine
 
     public:
 
-        // Generate and return a list of all the pseudo-legal moves for the position
-        static std::list<Move> GenerateMoves(const Board& board);
+        // The kinds of moves which may be generated
+        enum class Mode
+        {
+            All,                    // Every legal move
+            CapturesAndPromotions   // Only legal captures (including en passant) and promotions, used by quiescence search
+        };
+
+        // Generate and return a list of all the legal moves (of the given kind) for the position
+        static MoveList GenerateMoves(const Board& board, const Mode mode = Mode::All);
+
+        // Generate all the legal moves (of the given kind) for the position, adding them to the given (caller provided) list
+        static void GenerateMoves(const Board& board, MoveList& moveList, const Mode mode = Mode::All);
 
         // Determine whether a square is attacked or not
         static bool IsSquareAttacked(const Board& board, const Square init);
 
+        // Determine whether the player to move is in check
+        static bool IsInCheck(const Board& board);
+
+        // Determine whether a (legal) move would put the opponent in check, without making the move
+        static bool GivesCheck(const Board& board, const Move move);
+
+        // Get the pieces of a player which attack a square, given the occupied squares on the board
+        static Bitboard GetAttackers(const Board& board, const Square square, const Bitboard occupied, const bool isWhite);
+
     private:
 
-        // Generate and return a list of all the pseudo-legal moves for the pawn at the given square on the board
-        static void GeneratePawnMoves(MoveList& moveList, const Board& board, const Square init);
+        // The information needed to generate only legal moves, this is computed once per position
+        struct LegalMoveInfo
+        {
+            std::optional<Square> kingSquare;   // The square of the player to move's king (if they have one)
+            Bitboard checkers = 0;              // The opponent's pieces which are giving check
+            Bitboard pinned = 0;                // The player's pieces which are pinned to their king
+            Bitboard attacked = 0;              // The squares attacked by the opponent (seen through the player's king)
+            Bitboard targets = ~0ULL;           // The squares which a piece other than the king must move to (to resolve any check)
+            bool capturesOnly = false;          // Whether only captures and promotions are being generated
+        };
+
+        // Compute the information needed to generate only legal moves for the position
+        static LegalMoveInfo GetLegalMoveInfo(const Board& board);
+
+        // Get the squares which the (non-king) piece at init may legally move to, considering checks and pins
+        static Bitboard GetLegalSquares(const LegalMoveInfo& info, const Square init);
+
+        // Get all the squares attacked by a player, given the occupied squares on the board
+        static Bitboard GetAttackedSquares(const Board& board, const bool isWhite, const Bitboard occupied);
+
+        // Determine whether an en passant capture by the pawn at init leaves the player's king safe
+        static bool IsEnPassantLegal(const Board& board, const LegalMoveInfo& info, const Square init, const Square dest);
+
+        // Generate all the legal moves for the pawn at the given square on the board
+        static void GeneratePawnMoves(MoveList& moveList, const Board& board, const Square init, const LegalMoveInfo& info);
 
-        // Generate and return a list of all the pseudo-legal moves for the knight at the given square on the board
-        static void GenerateKnightMoves(MoveList& moveList, const Board& board, const Square init);
+        // Generate all the legal moves for the knight at the given square on the board
+        static void GenerateKnightMoves(MoveList& moveList, const Board& board, const Square init, const LegalMoveInfo& info);
 
-        // Generate and return a list of all the pseudo-legal moves for the bishop at the given square on the board
-        static void GenerateBishopMoves(MoveList& moveList, const Board& board, const Square init);
+        // Generate all the legal moves for the bishop at the given square on the board
+        static void GenerateBishopMoves(MoveList& moveList, const Board& board, const Square init, const LegalMoveInfo& info);
 
-        // Generate and return a list of all the pseudo-legal moves for the rook at the given square on the board
-        static void GenerateRookMoves(MoveList& moveList, const Board& board, const Square init);
+        // Generate all the legal moves for the rook at the given square on the board
+        static void GenerateRookMoves(MoveList& moveList, const Board& board, const Square init, const LegalMoveInfo& info);
 
-        // Generate and return a list of all the pseudo-legal moves for the queen at the given square on the board
-        static void GenerateQueenMoves(MoveList& moveList, const Board& board, const Square init);
+        // Generate all the legal moves for the queen at the given square on the board
+        static void GenerateQueenMoves(MoveList& moveList, const Board& board, const Square init, const LegalMoveInfo& info);
 
-        // Generate and return a list of all the pseudo-legal moves for the king at the given square on the board
-        static void GenerateKingMoves(MoveList& moveList, const Board& board, const Square init);
+        // Generate all the legal moves for the king at the given square on the board
+        static void GenerateKingMoves(MoveList& moveList, const Board& board, const Square init, const LegalMoveInfo& info);
 
-        // Helper function for generating all pseudo-legal moves moving the piece at init along a given line (diagonal, rank or file)
-        static void GenerateMovesAlongLine(MoveList& moveList, const Board& board, const Square init, const char lineOffset);
+        // Helper function for generating all moves moving the piece at init to the given squares (those it attacks),
+        // excluding the squares occupied by the player's own pieces (and empty squares when only generating captures)
+        static void GenerateMovesToSquares(MoveList& moveList, const Board& board, const Square init, const Bitboard squares, const LegalMoveInfo& info);
     };
 }
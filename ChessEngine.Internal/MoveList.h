@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <initializer_list>
+
+#include "Definitions.h"
+#include "Move.h"
+
+namespace ChessEngine
+{
+    // A fixed capacity list of moves which is stored contiguously (on the stack when declared locally)
+    // so that generating moves never needs to allocate. The capacity comfortably exceeds the maximum
+    // number of pseudo-legal moves in any reachable position (legal positions have at most 218 moves).
+    class MoveList
+    {
+    public:
+
+        constexpr static size_t MaxMoves = 256; // The maximum number of moves which the list can hold
+
+        // Create a new empty move list
+        MoveList() = default;
+
+        // Create a new move list containing the given moves
+        MoveList(std::initializer_list<Move> moves)
+        {
+            for (const Move& move : moves)
+            {
+                push_back(move);
+            }
+        }
+
+        // Add a move to the end of the list
+        void push_back(const Move move) { m_moves[m_size++] = move; }
+
+        // Remove all the moves from the list
+        void clear() { m_size = 0; }
+
+        // Get the number of moves in the list
+        size_t size() const { return m_size; }
+
+        // Get whether the list has no moves
+        bool empty() const { return m_size == 0; }
+
+        // Get the move at a given index in the list
+        Move& operator[](const size_t index) { return m_moves[index]; }
+        const Move& operator[](const size_t index) const { return m_moves[index]; }
+
+        // Iterators over the moves in the list
+        Move* begin() { return m_moves.data(); }
+        Move* end() { return m_moves.data() + m_size; }
+        const Move* begin() const { return m_moves.data(); }
+        const Move* end() const { return m_moves.data() + m_size; }
+
+    private:
+
+        std::array<Move, MaxMoves> m_moves; // The underlying storage for the moves
+
+        size_t m_size = 0;  // The number of moves in the list
+    };
+}
@@ -0,0 +1,147 @@
+#include "pch.h"
+
+#include "MovePicker.h"
+
+#include "Board.h"
+#include "BoardEvaluator.h"
+#include "Piece.h"
+#include "StaticExchange.h"
+
+namespace ChessEngine
+{
+    namespace
+    {
+        // The score of an underpromotion which is not a capture, these are rarely good so are picked after quiet moves
+        constexpr int UnderpromotionScore = -MovePicker::CaptureScore;
+
+        // Get the order of a type of piece by value (pawn = 1, ..., king = 6), used for MVV-LVA scoring
+        int GetTypeOrder(const Piece::Type type)
+        {
+            switch (type)
+            {
+            case Piece::Type::Pawn:   return 1;
+            case Piece::Type::Knight: return 2;
+            case Piece::Type::Bishop: return 3;
+            case Piece::Type::Rook:   return 4;
+            case Piece::Type::Queen:  return 5;
+            case Piece::Type::King:   return 6;
+            default:                  return 0;
+            }
+        }
+    }
+
+    MovePicker::MovePicker(MoveList& moveList, const Board& board, const Move hashMove) :
+        m_moveList(moveList)
+    {
+        // NOTE:
+        // The hash move is only picked first if it was generated for this position, as a hash
+        // collision could otherwise lead to us making a move which is not valid for the position.
+        for (size_t i = 0; i < m_moveList.size(); i++)
+        {
+            m_scores[i] = ScoreMove(board, m_moveList[i], hashMove);
+        }
+    }
+
+    MovePicker::MovePicker(
+        MoveList& moveList,
+        const Board& board,
+        const Move hashMove,
+        const SearchHistory& history,
+        const unsigned char ply,
+        const PreviousMoves& previousMoves) :
+        m_moveList(moveList)
+    {
+        for (size_t i = 0; i < m_moveList.size(); i++)
+        {
+            m_scores[i] = ScoreMove(board, m_moveList[i], hashMove, history, ply, previousMoves);
+        }
+    }
+
+    Move MovePicker::PickNext()
+    {
+        // Find the highest scoring move remaining and swap it into the next position
+        size_t bestIndex = m_index;
+        for (size_t i = m_index + 1; i < m_moveList.size(); i++)
+        {
+            if (m_scores[i] > m_scores[bestIndex])
+            {
+                bestIndex = i;
+            }
+        }
+
+        std::swap(m_moveList[m_index], m_moveList[bestIndex]);
+        std::swap(m_scores[m_index], m_scores[bestIndex]);
+
+        return m_moveList[m_index++];
+    }
+
+    int MovePicker::ScoreMove(const Board& board, const Move move, const Move hashMove)
+    {
+        if (move == hashMove)
+        {
+            return HashMoveScore;
+        }
+
+        int score = 0;
+
+        if (move.IsCapture())
+        {
+            const Piece::Type victim = (move.IsEnPassantCapture()
+                ? Piece::Type::Pawn
+                : board.GetPieces()[move.GetDestSquare()].GetType());
+            const Piece::Type attacker = board.GetPieces()[move.GetInitSquare()].GetType();
+
+            // Prefer capturing the most valuable victim, then capturing with the least valuable attacker. A capture can only
+            // lose material if the attacker is worth more than the victim, so only then is the (slower) SEE needed.
+            const bool isBadCapture = (
+                BoardEvaluator::GetPieceValue(attacker) > BoardEvaluator::GetPieceValue(victim) &&
+                StaticExchange::SEE(board, move) < 0);
+
+            score += (isBadCapture ? BadCaptureScore : CaptureScore) + (8 * GetTypeOrder(victim)) - GetTypeOrder(attacker);
+        }
+
+        if (move.IsPromotion())
+        {
+            if (move.GetPromotionType() == Piece::Type::Queen)
+            {
+                score += (move.IsCapture() ? 0 : CaptureScore) + (8 * GetTypeOrder(Piece::Type::Queen));
+            }
+            else if (!move.IsCapture())
+            {
+                score += UnderpromotionScore;
+            }
+        }
+
+        return score;
+    }
+
+    int MovePicker::ScoreMove(
+        const Board& board,
+        const Move move,
+        const Move hashMove,
+        const SearchHistory& history,
+        const unsigned char ply,
+        const PreviousMoves& previousMoves)
+    {
+        if (move == hashMove || move.IsCapture() || move.IsPromotion())
+        {
+            return ScoreMove(board, move, hashMove);
+        }
+
+        const auto& killers = history.GetKillers(ply);
+        for (size_t i = 0; i < killers.size(); i++)
+        {
+            if (move == killers[i])
+            {
+                return KillerScore - static_cast<int>(i);
+            }
+        }
+
+        if (move == history.GetCounterMove(previousMoves[0]))
+        {
+            return CounterScore;
+        }
+
+        return history.GetQuietScore(board.GetWhiteToPlay(), { move, board.GetPieces()[move.GetInitSquare()] }, previousMoves);
+    }
+}
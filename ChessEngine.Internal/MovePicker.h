@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Definitions.h"
+#include "Move.h"
+#include "MoveList.h"
+#include "SearchHistory.h"
+
+namespace ChessEngine
+{
+    // Picks the moves of a list one at a time, most appealing first. Each move is given an integer score up front
+    // and the moves are then selected lazily (a partial selection sort), so that a position which is cut off after
+    // its first few moves never pays for ordering the rest of them.
+    class MovePicker
+    {
+    public:
+
+        constexpr static int HashMoveScore = 1'000'000; // The score of the hash move, which is always picked first
+        constexpr static int CaptureScore  = 100'000;   // The base score of captures (and queen promotions), which are picked before quiet moves
+        constexpr static int KillerScore   = 90'000;    // The score of the first killer move, which is picked after the captures but before other quiet moves
+        constexpr static int CounterScore  = 80'000;    // The score of the counter move (if not a killer), which is picked after the killer moves
+        constexpr static int BadCaptureScore = -60'000; // The base score of captures which lose material (by SEE), which are picked after quiet moves
+
+        // Create a new move picker over the moves in a list (which the picker reorders in place, so it must outlive
+        // the picker), scoring each move for the given position. The hash move (if any) is picked first.
+        MovePicker(MoveList& moveList, const Board& board, const Move hashMove);
+
+        // As above, but with the quiet moves ordered by the killer moves for the given ply, then the counter move to the
+        // previous move and then their history scores (following the previous moves)
+        MovePicker(
+            MoveList& moveList,
+            const Board& board,
+            const Move hashMove,
+            const SearchHistory& history,
+            const unsigned char ply,
+            const PreviousMoves& previousMoves);
+
+        // Get whether there are moves which have not been picked yet
+        bool HasNext() const { return m_index < m_moveList.size(); }
+
+        // Pick the most appealing move which has not been picked yet
+        Move PickNext();
+
+        // Get the score of a move in a given position, captures are scored by MVV-LVA (most valuable victim,
+        // least valuable attacker) and queen promotions as though they captured a queen. Captures which lose
+        // material by static exchange evaluation are scored below the quiet moves.
+        static int ScoreMove(const Board& board, const Move move, const Move hashMove);
+
+        // As above, but with the quiet moves scored by the killer moves for the given ply, then the counter move to the
+        // previous move and then their history scores (following the previous moves)
+        static int ScoreMove(
+            const Board& board,
+            const Move move,
+            const Move hashMove,
+            const SearchHistory& history,
+            const unsigned char ply,
+            const PreviousMoves& previousMoves);
+
+    private:
+
+        MoveList& m_moveList;   // The moves being picked
+
+        std::array<int, MoveList::MaxMoves> m_scores;   // The score of each move in the list
+
+        size_t m_index = 0; // The index of the next move to be picked
+    };
+}
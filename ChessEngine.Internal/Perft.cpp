@@ -0,0 +1,264 @@
+#include "pch.h"
+
+#include "Perft.h"
+
+#include <thread>
+
+#include "Board.h"
+#include "MoveGenerator.h"
+#include "MoveInverse.h"
+#include "MoveList.h"
+
+namespace ChessEngine
+{
+    namespace
+    {
+        constexpr uint64_t DepthMask = 0xFF;    // The mask for extracting the depth from the data of a hash table entry
+        constexpr unsigned int NodesOffset = 8; // The offset of the number of nodes in the data of a hash table entry
+    }
+
+    PerftHashTable::PerftHashTable(const size_t sizeInMB)
+    {
+        // Use the largest power of 2 number of entries that fits in the requested size
+        const size_t maxNumEntries = std::max<size_t>((sizeInMB * 1024 * 1024) / sizeof(Entry), 1);
+
+        size_t numEntries = 1;
+        while ((numEntries * 2) <= maxNumEntries)
+        {
+            numEntries *= 2;
+        }
+
+        m_entries.reset(new Entry[numEntries]());
+        m_mask = numEntries - 1;
+    }
+
+    std::optional<uint64_t> PerftHashTable::Probe(const uint64_t hash, const unsigned char depth) const
+    {
+        const Entry& entry = GetEntry(hash, depth);
+
+        const uint64_t data = entry.data.load(std::memory_order_relaxed);
+        const uint64_t check = entry.check.load(std::memory_order_relaxed);
+
+        if (((check ^ data) == hash) && ((data & DepthMask) == depth))
+        {
+            return (data >> NodesOffset);
+        }
+
+        return std::nullopt;
+    }
+
+    void PerftHashTable::Store(const uint64_t hash, const unsigned char depth, const uint64_t nodes)
+    {
+        Entry& entry = GetEntry(hash, depth);
+
+        const uint64_t data = (nodes << NodesOffset) | depth;
+
+        entry.check.store(hash ^ data, std::memory_order_relaxed);
+        entry.data.store(data, std::memory_order_relaxed);
+    }
+
+    uint64_t Perft::CountNodes(Board& board, const unsigned char depth, PerftHashTable* hashTable)
+    {
+        if (depth == 0)
+        {
+            return 1;
+        }
+
+        if (hashTable && depth > 1)
+        {
+            if (const auto nodes = hashTable->Probe(board.GetHash(), depth))
+            {
+                return *nodes;
+            }
+        }
+
+        MoveList moveList;
+        MoveGenerator::GenerateMoves(board, moveList);
+
+        // As only legal moves are generated, the leaf nodes one ply from here are
+        // counted in bulk rather than making and undoing each of the moves
+        if (depth == 1)
+        {
+            return moveList.size();
+        }
+
+        uint64_t nodes = 0;
+
+        for (const Move& move : moveList)
+        {
+            MoveInverse moveInverse(board, move);
+            board.MakeMove(move);
+
+            nodes += CountNodes(board, depth - 1, hashTable);
+
+            board.UndoMove(moveInverse);
+        }
+
+        if (hashTable)
+        {
+            hashTable->Store(board.GetHash(), depth, nodes);
+        }
+
+        return nodes;
+    }
+
+    PerftResult Perft::Divide(Board& board, const unsigned char depth)
+    {
+        PerftResult result;
+
+        const auto start = std::chrono::system_clock::now();
+
+        if (depth == 0)
+        {
+            result.nodes = 1;
+        }
+        else
+        {
+            for (const Move& move : MoveGenerator::GenerateMoves(board))
+            {
+                MoveInverse moveInverse(board, move);
+                board.MakeMove(move);
+
+                const uint64_t nodes = CountNodes(board, depth - 1);
+
+                board.UndoMove(moveInverse);
+
+                result.divide.emplace_back(move, nodes);
+                result.nodes += nodes;
+            }
+        }
+
+        result.time = std::chrono::system_clock::now() - start;
+
+        return result;
+    }
+
+    PerftResult Perft::DivideParallel(
+        const Board& board,
+        const unsigned char depth,
+        const unsigned int numThreads,
+        const size_t hashSizeInMB)
+    {
+        // Below two ply there is too little work to be worth sharing
+        if (depth < 2)
+        {
+            Board boardCopy = board;
+            return Divide(boardCopy, depth);
+        }
+
+        PerftResult result;
+
+        const auto start = std::chrono::system_clock::now();
+
+        std::optional<PerftHashTable> hashTable;
+        if (hashSizeInMB > 0)
+        {
+            hashTable.emplace(hashSizeInMB);
+        }
+
+        // The work shared between the threads is the moves two ply from the root (rather than the root moves),
+        // as there are enough of these that the threads finish at roughly the same time.
+        struct WorkItem
+        {
+            size_t rootIndex;   // The index of the root move in the divide
+            Move rootMove;      // The root move
+            Move childMove;     // The move in reply to the root move
+        };
+
+        std::vector<WorkItem> workItems;
+
+        Board rootBoard = board;
+        for (const Move& rootMove : MoveGenerator::GenerateMoves(rootBoard))
+        {
+            result.divide.emplace_back(rootMove, 0);
+
+            MoveInverse rootMoveInverse(rootBoard, rootMove);
+            rootBoard.MakeMove(rootMove);
+
+            for (const Move& childMove : MoveGenerator::GenerateMoves(rootBoard))
+            {
+                workItems.push_back({ result.divide.size() - 1, rootMove, childMove });
+            }
+
+            rootBoard.UndoMove(rootMoveInverse);
+        }
+
+        std::vector<uint64_t> workItemNodes(workItems.size(), 0);
+        std::atomic<size_t> nextWorkItem = 0;
+
+        // Lambda run by each thread, taking the next work item until there are none left
+        auto countWorkItems = [&](PerftThreadResult& threadResult) -> void
+        {
+            const auto threadStart = std::chrono::system_clock::now();
+
+            Board threadBoard = board;
+
+            for (size_t i = nextWorkItem++; i < workItems.size(); i = nextWorkItem++)
+            {
+                const WorkItem& workItem = workItems[i];
+
+                MoveInverse rootMoveInverse(threadBoard, workItem.rootMove);
+                threadBoard.MakeMove(workItem.rootMove);
+
+                MoveInverse childMoveInverse(threadBoard, workItem.childMove);
+                threadBoard.MakeMove(workItem.childMove);
+
+                workItemNodes[i] = CountNodes(threadBoard, depth - 2, (hashTable ? &*hashTable : nullptr));
+                threadResult.nodes += workItemNodes[i];
+
+                threadBoard.UndoMove(childMoveInverse);
+                threadBoard.UndoMove(rootMoveInverse);
+            }
+
+            threadResult.time = std::chrono::system_clock::now() - threadStart;
+        };
+
+        result.threads.resize(std::max(numThreads, 1U));
+
+        std::vector<std::thread> threads;
+        for (PerftThreadResult& threadResult : result.threads)
+        {
+            threads.emplace_back(countWorkItems, std::ref(threadResult));
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (size_t i = 0; i < workItems.size(); i++)
+        {
+            result.divide[workItems[i].rootIndex].second += workItemNodes[i];
+            result.nodes += workItemNodes[i];
+        }
+
+        result.time = std::chrono::system_clock::now() - start;
+
+        return result;
+    }
+
+    void Perft::PrintResult(const PerftResult& result)
+    {
+        std::stringstream ss;
+
+        for (const auto& [move, nodes] : result.divide)
+        {
+            ss << move.GetLongAlgebraicString() << ": " << nodes << "\n";
+        }
+
+        ss  << "\n"
+            << "Nodes: " << result.nodes << "\n"
+            << "Time: " << result.time.count() << " seconds" << "\n"
+            << "Nodes/second: " << static_cast<uint64_t>(result.GetNodesPerSecond()) << "\n";
+
+        for (size_t i = 0; i < result.threads.size(); i++)
+        {
+            ss  << "    Thread " << i << ": "
+                << result.threads[i].nodes << " nodes, "
+                << static_cast<uint64_t>(result.threads[i].GetNodesPerSecond()) << " nodes/second" << "\n";
+        }
+
+        std::cout << ss.str();
+        std::cout.flush();
+    }
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "Definitions.h"
+#include "Move.h"
+
+namespace ChessEngine
+{
+    // The nodes counted by a single thread during a perft run
+    struct PerftThreadResult
+    {
+        uint64_t nodes = 0;                         // The number of leaf nodes counted by the thread
+        std::chrono::duration<double> time{ 0.0 };  // The time the thread spent counting (seconds)
+
+        // Get the number of leaf nodes counted per second by the thread
+        double GetNodesPerSecond() const { return (time.count() > 0.0 ? nodes / time.count() : 0.0); }
+    };
+
+    // The result of a perft (performance test) run
+    struct PerftResult
+    {
+        uint64_t nodes = 0;                                 // The total number of leaf nodes
+        std::vector<std::pair<Move, uint64_t>> divide;      // The number of leaf nodes below each root move
+        std::chrono::duration<double> time{ 0.0 };          // The time taken (seconds)
+
+        std::vector<PerftThreadResult> threads;     // The nodes counted by each thread (only for parallel runs)
+
+        // Get the number of leaf nodes counted per second
+        double GetNodesPerSecond() const { return (time.count() > 0.0 ? nodes / time.count() : 0.0); }
+    };
+
+    // A hash table caching the number of leaf nodes below a position at a given depth. This may be shared between
+    // threads without locking, each entry stores its key XORed with its data so that an entry which is torn by two
+    // threads writing it at once will not match either key (https://www.chessprogramming.org/Shared_Hash_Table).
+    class PerftHashTable
+    {
+    public:
+
+        // Create a new hash table with the given size (in MB)
+        PerftHashTable(const size_t sizeInMB);
+
+        // Get the number of leaf nodes below the position with the given hash to the given depth (if stored)
+        std::optional<uint64_t> Probe(const uint64_t hash, const unsigned char depth) const;
+
+        // Store the number of leaf nodes below the position with the given hash to the given depth
+        void Store(const uint64_t hash, const unsigned char depth, const uint64_t nodes);
+
+        // Get the total number of entries the table can hold
+        size_t GetNumEntries() const { return m_mask + 1; }
+
+    private:
+
+        // An entry in the table, the data holds the depth (lower 8 bits) and number of nodes (upper 56 bits)
+        struct Entry
+        {
+            std::atomic<uint64_t> check;    // The hash of the position XORed with the data
+            std::atomic<uint64_t> data;     // The depth and number of nodes
+        };
+
+        // Get the entry for a given hash and depth
+        Entry& GetEntry(const uint64_t hash, const unsigned char depth) { return m_entries[(hash + depth) & m_mask]; }
+        const Entry& GetEntry(const uint64_t hash, const unsigned char depth) const { return m_entries[(hash + depth) & m_mask]; }
+
+        std::unique_ptr<Entry[]> m_entries; // The entries (the number of entries is a power of 2)
+
+        uint64_t m_mask = 0;    // The mask for mapping a hash to an entry index
+    };
+
+    // Counts the leaf nodes of the tree of legal moves to a given depth, this is used to verify the move
+    // generator against known counts and to benchmark move generation and making/undoing moves.
+    // See https://www.chessprogramming.org/Perft for known counts of various positions.
+    class Perft
+    {
+    public:
+
+        // Count the leaf nodes of the tree of legal moves from a position to a given depth,
+        // using (and filling) the given hash table of subtree counts if there is one
+        static uint64_t CountNodes(Board& board, const unsigned char depth, PerftHashTable* hashTable = nullptr);
+
+        // Count the leaf nodes of the tree of legal moves from a position to a given depth, as well as the
+        // leaf nodes below each root move (the 'divide'), and time how long this takes
+        static PerftResult Divide(Board& board, const unsigned char depth);
+
+        // As Divide, but with the moves two ply from the root shared between the given number of threads (each with
+        // its own copy of the board), optionally caching subtree counts in a hash table of the given size (in MB)
+        static PerftResult DivideParallel(
+            const Board& board,
+            const unsigned char depth,
+            const unsigned int numThreads,
+            const size_t hashSizeInMB = 0);
+
+        // Print the result of a perft run to std::cout
+        static void PrintResult(const PerftResult& result);
+    };
+}
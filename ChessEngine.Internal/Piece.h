@@ -38,6 +38,28 @@ namespace ChessEngine
         // The array of all the piece types so we can iterate over them
         static const std::array<Type, 7> AllTypes;
 
+        // The number of distinct piece indices (one for each type and colour, see GetIndex)
+        constexpr static size_t NumIndices = 14;
+
+        // Get the index of a piece with the given properties (type, whether it is white), used to index flat tables
+        constexpr static size_t IndexFromType(const Type type, const bool isWhite)
+        {
+            size_t typeIndex = 0;
+
+            switch (type)
+            {
+            case Type::Empty:  typeIndex = 0; break;
+            case Type::Pawn:   typeIndex = 1; break;
+            case Type::Knight: typeIndex = 2; break;
+            case Type::Bishop: typeIndex = 3; break;
+            case Type::Rook:   typeIndex = 4; break;
+            case Type::Queen:  typeIndex = 5; break;
+            case Type::King:   typeIndex = 6; break;
+            }
+
+            return (typeIndex * 2) + (isWhite ? 0 : 1);
+        }
+
         // Create a new piece
         Piece() = default;
 
@@ -87,10 +109,17 @@ namespace ChessEngine
         // Get the value of the piece
         unsigned int GetValue() const { return m_piece; }
 
+        // Get the index of the piece (0 to NumIndices - 1), this is unique for each type and colour
+        size_t GetIndex() const { return Indices[m_piece]; }
+
         // Get the ascii representation of the piece
         char GetAscii() const;
 
     private:
+
+        // Lookup table mapping the underlying bitmap of a piece to its index
+        static const std::array<uint8_t, 256> Indices;
+
         uint8_t m_piece = 0; // Underlying bitmap
     };
 }
\ No newline at end of file
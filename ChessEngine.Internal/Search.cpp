@@ -2,30 +2,177 @@
 
 #include "Search.h"
 
+#include <cmath>
+
 #include "Board.h"
 #include "Definitions.h"
 #include "Move.h"
 #include "MoveGenerator.h"
 #include "MoveInverse.h"
+#include "MoveList.h"
+#include "MovePicker.h"
+#include "StaticExchange.h"
 
 namespace
 {
     constexpr bool CollectMetrics = true;
+
+    // A bound on all evaluations, this is used rather than std::numeric_limits<int>::min()/max()
+    // as with the negamax formulation evaluations are negated, and -min() would overflow
+    constexpr int Infinity = 1'000'000;
+
+    // Checkmates are within (-Infinity, +Infinity) so that a move is still chosen when every move leads to checkmate
+    static_assert(ChessEngine::Search::CheckmateEval < Infinity);
+
+    // The number of positions searched between checks of whether the search has run out of time
+    constexpr unsigned int TimeCheckInterval = 1024;
+
+    // The margin used for delta pruning in the quiescence search, a capture is skipped if the material it wins plus
+    // this margin can't raise the evaluation of the position to alpha (it allows for positional gains from the capture)
+    constexpr int DeltaPruningMargin = 200;
+
+    // The half width of the aspiration window around the previous iteration's evaluation, the window is
+    // widened (doubling the amount each time) whenever the search fails low or high
+    constexpr int AspirationWindow = 25;
+
+    // The minimum depth at which aspiration windows are used, the evaluation is too unstable at lower depths
+    constexpr int AspirationMinDepth = 4;
+
+    // The minimum depth at which null move pruning is tried
+    constexpr int NullMoveMinDepth = 3;
+
+    // The depth by which the null move search is reduced (beyond the ply for the null move itself), this is adaptive
+    // (https://www.chessprogramming.org/Null_Move_Pruning#Adaptive_Null_Move_Pruning) and larger for deeper searches
+    constexpr int NullMoveReduction = 2;
+    constexpr int NullMoveDeepReduction = 3;
+    constexpr int NullMoveDeepDepth = 6;    // The depth beyond which the deeper reduction is used
 }
 
 namespace ChessEngine
 {
+    Search::Search(const SearchParameters& parameters):
+        m_pvTable(SearchHistory::MaxPly + 1)
+    {
+        SetParameters(parameters);
+    }
+
+    void Search::SetParameters(const SearchParameters& parameters)
+    {
+        m_parameters = parameters;
+
+        // Reductions grow with both the depth and the move index, though only slowly (logarithmically)
+        for (size_t depth = 1; depth < ReductionTableSize; depth++)
+        {
+            for (size_t moveIndex = 1; moveIndex < ReductionTableSize; moveIndex++)
+            {
+                const double reduction = (
+                    m_parameters.lmrBase +
+                    (std::log(static_cast<double>(depth)) * std::log(static_cast<double>(moveIndex)) / m_parameters.lmrDivisor));
+
+                m_reductions[depth][moveIndex] = static_cast<unsigned char>(std::max(reduction, 0.0));
+            }
+        }
+    }
+
     std::pair<Move, int> Search::SearchPosition(Board& board, const unsigned char maxDepth)
     {
-        METRICS_SET_MAX_DEPTH(CollectMetrics, m_metrics, maxDepth);
+        SearchLimits limits;
+        limits.maxDepth = maxDepth;
+
+        return SearchPosition(board, limits);
+    }
+
+    std::pair<Move, int> Search::SearchPosition(Board& board, const SearchLimits& limits)
+    {
         METRICS_SEARCH_START(CollectMetrics, m_metrics);
 
-        std::pair<Move, int> searchResult = SearchPositionPruned(
-            board,
-            maxDepth,
-            std::numeric_limits<int>::min(),
-            std::numeric_limits<int>::max());
+        // Never search deeper than the deepest the search will ever go, whatever depth the limits ask for
+        const int maxDepth = std::min<int>(limits.maxDepth, SearchLimits::MaxDepth);
+
+        m_transpositionTable.IncrementAge();
+        m_history.Age();
+        m_timeManager.Start(limits, board.GetWhiteToPlay());
+
+        m_isStopping = false;
+        m_positionsUntilTimeCheck = TimeCheckInterval;
+        m_completedDepth = 0;
+        m_principalVariation.clear();
+        m_lines.clear();
+
+        // Convert from symmetric scoring to +ve for white, -ve for black
+        const int perspective = (board.GetWhiteToPlay() ? +1 : -1);
+
+        std::pair<Move, int> searchResult;
+
+        // Search one ply deeper each iteration, each iteration is sped up by the best moves found by the
+        // previous iterations (from the transposition table) being searched first
+        for (int depth = 1; depth <= maxDepth; depth++)
+        {
+            std::pair<Move, int> iterationResult;
+            std::vector<SearchLine> iterationLines;
+
+            if (limits.numLines > 1)
+            {
+                iterationLines = SearchRootLines(board, static_cast<unsigned char>(depth), limits.numLines);
+
+                if (!iterationLines.empty())
+                {
+                    iterationResult = std::pair<Move, int>(iterationLines[0].move, iterationLines[0].eval);
+                }
+                else
+                {
+                    iterationResult = std::pair<Move, int>(Move(), (MoveGenerator::IsInCheck(board) ? -CheckmateEval : 0));
+                }
+            }
+            else
+            {
+                iterationResult = SearchRootAspiration(board, static_cast<unsigned char>(depth), searchResult.second);
+
+                if (iterationResult.first != Move())
+                {
+                    iterationLines.push_back({ iterationResult.first, iterationResult.second, m_pvTable[0] });
+                }
+            }
+
+            // An iteration which ran out of time is discarded as not all of the moves were searched
+            if (m_isStopping)
+            {
+                break;
+            }
+
+            const bool bestMoveChanged = (depth > 1 && iterationResult.first != searchResult.first);
 
+            searchResult = iterationResult;
+            m_completedDepth = static_cast<unsigned char>(depth);
+            m_principalVariation = (iterationLines.empty() ? MoveList() : iterationLines[0].principalVariation);
+
+            m_lines = std::move(iterationLines);
+            for (SearchLine& line : m_lines)
+            {
+                line.eval *= perspective;
+            }
+
+            if (m_iterationReporter)
+            {
+                m_iterationReporter(m_completedDepth, m_lines);
+            }
+
+            m_timeManager.Update(bestMoveChanged, iterationResult.second);
+
+            // Stop if there are no moves to search, if a checkmate has been found within the depth searched (a deeper search
+            // won't find a shorter one, though the other lines may still change when searching several), or if the next
+            // iteration is unlikely to complete in time
+            if (searchResult.first == Move() ||
+                (limits.numLines <= 1 && IsCheckmateEval(searchResult.second) && GetCheckmateDistance(searchResult.second) <= depth) ||
+                !m_timeManager.ShouldStartIteration())
+            {
+                break;
+            }
+        }
+
+        searchResult.second *= perspective;
+
+        METRICS_SET_MAX_DEPTH(CollectMetrics, m_metrics, m_completedDepth);
         METRICS_SEARCH_STOP(CollectMetrics, m_metrics);
         METRICS_PRINT(CollectMetrics, m_metrics);
         METRICS_WRITE(CollectMetrics, m_metrics);
@@ -33,128 +180,819 @@ namespace ChessEngine
         return searchResult;
     }
 
-    // Implemented as per wikipedia description of alpha-beta pruning:
-    // https://en.wikipedia.org/wiki/Alpha%E2%80%93beta_pruning
+    std::pair<Move, int> Search::SearchRootAspiration(Board& board, const unsigned char depth, const int previousEval)
+    {
+        // Search with an aspiration window around the previous evaluation, which will usually contain the evaluation
+        // and allows more cutoffs than a full window. If the evaluation falls outside the window then it is only a
+        // bound, so the position is searched again with the window widened on the side which failed.
+        int delta = AspirationWindow;
+        int alpha = -Infinity;
+        int beta = +Infinity;
+
+        if (depth >= AspirationMinDepth)
+        {
+            alpha = std::max(previousEval - delta, -Infinity);
+            beta = std::min(previousEval + delta, +Infinity);
+        }
+
+        std::pair<Move, int> result;
+        while (true)
+        {
+            result = SearchPositionPruned(board, depth, 0, alpha, beta);
+
+            if (m_isStopping)
+            {
+                break;
+            }
+
+            if (result.second <= alpha)
+            {
+                alpha = std::max(alpha - delta, -Infinity);
+            }
+            else if (result.second >= beta)
+            {
+                beta = std::min(beta + delta, +Infinity);
+            }
+            else
+            {
+                break;
+            }
+
+            METRICS_ASPIRATION_RESEARCH_INCREMENT(CollectMetrics, m_metrics, 1);
+
+            delta *= 2;
+        }
+
+        return result;
+    }
+
+    std::vector<SearchLine> Search::SearchRootLines(Board& board, const unsigned char depth, const unsigned char numLines)
+    {
+        METRICS_SEARCH_INCREMENT(CollectMetrics, m_metrics, 1);
+
+        METRICS_GENERATION_START(CollectMetrics, m_metrics);
+
+        MoveList moveList;
+        MoveGenerator::GenerateMoves(board, moveList);
+
+        METRICS_GENERATION_STOP(CollectMetrics, m_metrics);
+        METRICS_GENERATION_INCREMENT(CollectMetrics, m_metrics, static_cast<int>(moveList.size()));
+
+        // The previous iteration's lines are searched first (best first), so that the window is narrowed to the Nth best
+        // evaluation as quickly as possible, followed by the other moves in the usual order
+        MoveList orderedMoves;
+        for (const SearchLine& line : m_lines)
+        {
+            if (std::find(moveList.begin(), moveList.end(), line.move) != moveList.end())
+            {
+                orderedMoves.push_back(line.move);
+            }
+        }
+
+        MovePicker movePicker(moveList, board, Move(), m_history, 0, GetPreviousMoves(0));
+        while (movePicker.HasNext())
+        {
+            const Move move = movePicker.PickNext();
+
+            if (std::find(orderedMoves.begin(), orderedMoves.end(), move) == orderedMoves.end())
+            {
+                orderedMoves.push_back(move);
+            }
+        }
+
+        // The previous iteration's evaluations are +ve for white and -ve for black, the evaluations here are negamax
+        const int perspective = (board.GetWhiteToPlay() ? +1 : -1);
+
+        const bool isInCheck = MoveGenerator::IsInCheck(board);
+
+        std::vector<SearchLine> lines;  // The best lines found so far (best first)
+
+        size_t moveIndex = 0;   // The number of moves searched so far
+
+        for (const Move& move : orderedMoves)
+        {
+            // Only moves which beat the Nth best line so far can be one of the best lines, so the Nth best evaluation is
+            // used as alpha. Moves which were one of the previous iteration's lines are searched with an aspiration window
+            // around their previous evaluation, the others are first proven to beat alpha with a zero window.
+            const int alpha = (lines.size() < numLines ? -Infinity : lines.back().eval);
+
+            int delta = AspirationWindow;
+            int windowAlpha = alpha;
+            int windowBeta = +Infinity;
+
+            const auto previousLine = std::find_if(m_lines.begin(), m_lines.end(), [move](const SearchLine& line) { return line.move == move; });
+            const bool wasLine = (previousLine != m_lines.end());
+            const int previousEval = (wasLine ? previousLine->eval * perspective : -Infinity);
+
+            const bool isQuiet = !(move.IsCapture() || move.IsPromotion());
+
+            m_searchStack[0] = { move, board.GetPieces()[move.GetInitSquare()] };
+
+            const int historyScore = (isQuiet
+                ? m_history.GetQuietScore(board.GetWhiteToPlay(), m_searchStack[0], GetPreviousMoves(0))
+                : 0);
+
+            MoveInverse moveInverse(board, move);
+            board.MakeMove(move);
+
+            const bool givesCheck = MoveGenerator::IsInCheck(board);
+
+            int eval = -Infinity;
+            bool beatsAlpha = true;
+
+            if (depth >= AspirationMinDepth && wasLine && previousEval + delta > alpha)
+            {
+                windowAlpha = std::max(previousEval - delta, alpha);
+                windowBeta = previousEval + delta;
+            }
+            else if (alpha != -Infinity)
+            {
+                // Late move reductions as in the rest of the search, counting only the moves ordered after the lines
+                int reduction = 0;
+                if (m_parameters.lateMoveReductions &&
+                    depth >= m_parameters.lmrMinDepth &&
+                    moveIndex >= numLines + m_parameters.lmrMinMoveIndex &&
+                    isQuiet &&
+                    !isInCheck &&
+                    !givesCheck)
+                {
+                    reduction = GetLateMoveReduction(depth, moveIndex - numLines, historyScore);
+                }
+
+                if (reduction > 0)
+                {
+                    METRICS_LMR_REDUCTION_INCREMENT(CollectMetrics, m_metrics, 1);
+                }
+
+                eval = -SearchPositionPruned(board, static_cast<unsigned char>(depth - 1 - reduction), 1, -alpha - 1, -alpha).second;
+
+                if (reduction > 0 && eval > alpha && !m_isStopping)
+                {
+                    METRICS_LMR_RESEARCH_INCREMENT(CollectMetrics, m_metrics, 1);
+
+                    eval = -SearchPositionPruned(board, depth - 1, 1, -alpha - 1, -alpha).second;
+                }
+
+                beatsAlpha = (eval > alpha);
+
+                if (beatsAlpha)
+                {
+                    METRICS_PVS_RESEARCH_INCREMENT(CollectMetrics, m_metrics, 1);
+                }
+            }
+
+            while (beatsAlpha && !m_isStopping)
+            {
+                eval = -SearchPositionPruned(board, depth - 1, 1, -windowBeta, -windowAlpha).second;
+
+                if (m_isStopping)
+                {
+                    break;
+                }
+
+                // A move which fails low at alpha itself isn't one of the best lines, so there is no need to search it again
+                if (eval <= windowAlpha && windowAlpha > alpha)
+                {
+                    windowAlpha = std::max(windowAlpha - delta, alpha);
+                }
+                else if (eval >= windowBeta)
+                {
+                    windowBeta = std::min(windowBeta + delta, +Infinity);
+                }
+                else
+                {
+                    break;
+                }
+
+                METRICS_ASPIRATION_RESEARCH_INCREMENT(CollectMetrics, m_metrics, 1);
+
+                delta *= 2;
+            }
+
+            board.UndoMove(moveInverse);
+
+            moveIndex++;
+
+            // The search ran out of time so the eval can't be trusted, the iteration is discarded
+            if (m_isStopping)
+            {
+                return lines;
+            }
+
+            if (eval > alpha)
+            {
+                UpdatePrincipalVariation(0, move);
+
+                const SearchLine line{ move, eval, m_pvTable[0] };
+                lines.insert(
+                    std::upper_bound(lines.begin(), lines.end(), line, [](const SearchLine& a, const SearchLine& b) { return a.eval > b.eval; }),
+                    line);
+
+                if (lines.size() > numLines)
+                {
+                    lines.pop_back();
+                }
+            }
+        }
+
+        // Store the best line so that it is searched first if the position is searched again
+        if (!lines.empty())
+        {
+            m_transpositionTable.Store(
+                board.GetHash(),
+                depth,
+                TranspositionTableEntry::Bound::Exact,
+                ToTranspositionEval(lines[0].eval, 0),
+                lines[0].move);
+        }
+
+        return lines;
+    }
+
+    bool Search::IsStopping()
+    {
+        // Checking the time is relatively expensive so it is only done every so many positions,
+        // and the first iteration is always completed so that there is a move to return
+        if (!m_isStopping && m_completedDepth > 0 && --m_positionsUntilTimeCheck == 0)
+        {
+            m_positionsUntilTimeCheck = TimeCheckInterval;
+            m_isStopping = m_timeManager.IsTimeUp();
+        }
+
+        return m_isStopping;
+    }
+
+    // Implemented as per wikipedia description of alpha-beta pruning (negamax variant) with transposition tables:
+    // https://en.wikipedia.org/wiki/Negamax#Negamax_with_alpha_beta_pruning_and_transposition_tables
     std::pair<Move, int> Search::SearchPositionPruned(
         Board& board,
-        const unsigned char maxDepth, 
+        const unsigned char maxDepth,
+        const unsigned char ply,
         int alpha,
         int beta)
     {
-        METRICS_SEARCH_INCREMENT(CollectMetrics, m_metrics, 1);
+        // No principal variation has been found from this ply yet
+        m_pvTable[ply].clear();
 
+        // At the horizon continue with the quiescence search rather than evaluating the position straight away
         if (maxDepth == 0)
         {
-            METRICS_EVALUATION_START(CollectMetrics, m_metrics);
+            return std::pair<Move, int>(Move(), SearchQuiescence(board, ply, alpha, beta));
+        }
+
+        METRICS_SEARCH_INCREMENT(CollectMetrics, m_metrics, 1);
+
+        if (IsStopping())
+        {
+            return std::pair<Move, int>(Move(), 0);
+        }
+
+        // A position which repeats an earlier one is scored as a draw straight away, as either player could repeat the
+        // moves in between to reach a threefold repetition. This is never done at the root as we need to return a move.
+        // Checkmate takes precedence over the fifty move rule, so it is only a draw if the player to move isn't mated.
+        if (ply > 0 && (
+            board.IsRepetition() ||
+            (board.IsFiftyMoveDraw() && (!MoveGenerator::IsInCheck(board) || !MoveGenerator::GenerateMoves(board).empty())) ||
+            board.IsInsufficientMaterial()))
+        {
+            METRICS_SEARCH_DRAW_INCREMENT(CollectMetrics, m_metrics, 1);
+
+            return std::pair<Move, int>(Move(), 0);
+        }
+
+        // Whether this position may be part of the principal variation (searched with a full rather than a zero window)
+        const bool isPvNode = (beta - alpha > 1);
 
-            // Convert from symmetric scoring to +ve for white, -ve for black
-            int eval = m_evaluator.Evaluate(board) * (board.GetWhiteToPlay() ? +1 : -1);
+        // Mate distance pruning, no line through this position can do better than checkmating on the next move nor worse
+        // than being checkmated now. If a shorter checkmate is already known the window is empty and there is no need to search.
+        if (ply > 0)
+        {
+            alpha = std::max(alpha, -CheckmateEval + ply);
+            beta = std::min(beta, CheckmateEval - ply - 1);
 
-            METRICS_EVALUATION_STOP(CollectMetrics, m_metrics);
-            METRICS_EVALUATION_INCREMENT(CollectMetrics, m_metrics, 1);
+            if (alpha >= beta)
+            {
+                METRICS_MATE_DISTANCE_CUTOFF_INCREMENT(CollectMetrics, m_metrics, 1);
 
-            return std::pair<Move, int>(Move(), eval);
+                return std::pair<Move, int>(Move(), alpha);
+            }
         }
 
-        Move bestMove;
-        int  bestEval;
+        const int alphaOriginal = alpha;
+
+        // Check whether this position has been searched before. If it has been searched deep enough
+        // we may be able to return immediately, otherwise its best move is still worth searching first.
+        Move hashMove;
+        if (const auto entry = m_transpositionTable.Probe(board.GetHash()))
+        {
+            METRICS_TRANSPOSITION_HIT_INCREMENT(CollectMetrics, m_metrics, 1);
+
+            hashMove = entry->GetMove();
+
+            const int entryEval = FromTranspositionEval(entry->GetEval(), ply);
+
+            // Never cut off at the root as we need to return a move which is known to be valid, nor in the principal
+            // variation as the line below this position would be missing from it
+            if (ply > 0 && !isPvNode && entry->GetDepth() >= maxDepth)
+            {
+                switch (entry->GetBound())
+                {
+                case TranspositionTableEntry::Bound::Exact:
+                    alpha = beta = entryEval;
+                    break;
+                case TranspositionTableEntry::Bound::Lower:
+                    alpha = std::max(alpha, entryEval);
+                    break;
+                case TranspositionTableEntry::Bound::Upper:
+                    beta = std::min(beta, entryEval);
+                    break;
+                default:
+                    break;
+                }
+
+                if (alpha >= beta)
+                {
+                    METRICS_TRANSPOSITION_CUTOFF_INCREMENT(CollectMetrics, m_metrics, 1);
+
+                    return std::pair<Move, int>(hashMove, entryEval);
+                }
+            }
+        }
+
+        // The previous iteration's principal variation is searched first, so that the best line found so far is quickly
+        // re-established (the transposition table entries for the line may have been overwritten)
+        if (isPvNode)
+        {
+            if (const Move pvMove = GetPrincipalVariationMove(ply); pvMove != Move())
+            {
+                hashMove = pvMove;
+            }
+        }
+
+        const bool isInCheck = MoveGenerator::IsInCheck(board);
+
+        // The static evaluation is used to decide whether to prune, it is meaningless when in check (the player to move
+        // may be about to lose material) so isn't used then
+        const int staticEval = (isInCheck ? -Infinity : Evaluate(board));
+
+        // Reverse futility pruning, the static evaluation is so far above beta that the position is almost certain
+        // to fail high (the player to move could likely make a quiet move and still stay above beta)
+        if (m_parameters.reverseFutilityPruning &&
+            ply > 0 &&
+            !isPvNode &&
+            !isInCheck &&
+            maxDepth <= m_parameters.reverseFutilityMaxDepth &&
+            staticEval - (m_parameters.reverseFutilityMargin * maxDepth) >= beta)
+        {
+            METRICS_REVERSE_FUTILITY_CUTOFF_INCREMENT(CollectMetrics, m_metrics, 1);
+
+            return std::pair<Move, int>(Move(), staticEval);
+        }
+
+        // Razoring, the static evaluation is so far below alpha that only captures are likely to raise it enough, so
+        // check with the quiescence search whether the position can beat alpha before searching it in full
+        if (m_parameters.razoring &&
+            ply > 0 &&
+            !isPvNode &&
+            !isInCheck &&
+            maxDepth <= m_parameters.razoringMaxDepth &&
+            staticEval + (m_parameters.razoringMargin * maxDepth) <= alpha)
+        {
+            const int eval = SearchQuiescence(board, ply, alpha, alpha + 1);
+
+            if (m_isStopping)
+            {
+                return std::pair<Move, int>(Move(), 0);
+            }
+
+            if (eval <= alpha)
+            {
+                METRICS_RAZORING_CUTOFF_INCREMENT(CollectMetrics, m_metrics, 1);
+
+                return std::pair<Move, int>(Move(), eval);
+            }
+        }
+
+        // Null move pruning, give the opponent a free move and search the position to a reduced depth. If this still
+        // fails high then the position is almost certainly good enough to fail high when searched in full. This is
+        // not done in PV nodes (where an exact eval is needed), when in check (passing would be illegal), after a null
+        // move or without pieces other than pawns (where zugzwang is common, so passing may be better than any legal move).
+        if (ply > 0 &&
+            !isPvNode &&
+            maxDepth >= NullMoveMinDepth &&
+            !isInCheck &&
+            staticEval >= beta &&
+            m_searchStack[ply - 1].move != Move() &&
+            HasNonPawnMaterial(board))
+        {
+            const int reduction = (maxDepth > NullMoveDeepDepth ? NullMoveDeepReduction : NullMoveReduction);
+            const int nullMoveDepth = std::max(maxDepth - 1 - reduction, 0);
+
+            m_searchStack[ply] = PlayedMove();
+
+            MoveInverse moveInverse(board, Move());
+            board.MakeNullMove();
+
+            const int eval = -SearchPositionPruned(board, static_cast<unsigned char>(nullMoveDepth), ply + 1, -beta, -beta + 1).second;
+
+            board.UndoNullMove(moveInverse);
+
+            if (m_isStopping)
+            {
+                return std::pair<Move, int>(Move(), 0);
+            }
+
+            if (eval >= beta)
+            {
+                METRICS_NULL_MOVE_CUTOFF_INCREMENT(CollectMetrics, m_metrics, 1);
+
+                return std::pair<Move, int>(Move(), beta);
+            }
+        }
 
         METRICS_GENERATION_START(CollectMetrics, m_metrics);
 
-        const MoveList moveList = SortMoves(MoveGenerator::GenerateMoves(board));
+        MoveList moveList;
+        MoveGenerator::GenerateMoves(board, moveList);
+        const PreviousMoves previousMoves = GetPreviousMoves(ply);
+        MovePicker movePicker(moveList, board, hashMove, m_history, ply, previousMoves);
 
         METRICS_GENERATION_STOP(CollectMetrics, m_metrics);
         METRICS_GENERATION_INCREMENT(CollectMetrics, m_metrics, static_cast<int>(moveList.size()));
 
-        if (board.GetWhiteToPlay())
+        // With no legal moves the game is over, the player to move has either been checkmated or it is stalemate
+        if (moveList.empty())
+        {
+            return std::pair<Move, int>(Move(), (isInCheck ? -CheckmateEval + ply : 0));
+        }
+
+        Move bestMove;
+        int  bestEval = -Infinity;
+
+        MoveList quietsSearched;    // The quiet moves searched so far, whose history is penalized if a later quiet move cuts off
+
+        size_t moveIndex = 0;   // The number of moves searched so far
+
+        // Whether the static evaluation is so far below alpha that quiet moves are unlikely to raise it above alpha
+        const bool isFutile = (
+            m_parameters.futilityPruning &&
+            ply > 0 &&
+            !isInCheck &&
+            maxDepth <= m_parameters.futilityMaxDepth &&
+            staticEval + (m_parameters.futilityMargin * maxDepth) <= alpha);
+
+        while (movePicker.HasNext())
         {
-            bestEval = std::numeric_limits<int>::min();
+            const Move move = movePicker.PickNext();
+            const bool isQuiet = !(move.IsCapture() || move.IsPromotion());
+
+            m_searchStack[ply] = { move, board.GetPieces()[move.GetInitSquare()] };
+
+            // The quiet score must be looked up before the move is made (while the piece is still on its initial square)
+            const int historyScore = (isQuiet
+                ? m_history.GetQuietScore(board.GetWhiteToPlay(), m_searchStack[ply], previousMoves)
+                : 0);
 
-            for (const Move& move : moveList)
+            // Late move pruning and history pruning, near the leaves skip the quiet moves which are ordered very late
+            // or have a very bad history as they almost never cause a cutoff. This is only done once a move which
+            // doesn't lose (to checkmate) has been found, and not at the root or when in check (where every evasion matters).
+            if (ply > 0 && isQuiet && !isInCheck && bestEval > -CheckmateBound)
             {
-                MoveInverse moveInverse(board, move);
-                board.MakeMove(move);
+                if (m_parameters.lateMovePruning &&
+                    maxDepth <= m_parameters.lmpMaxDepth &&
+                    moveIndex >= static_cast<size_t>(m_parameters.lmpBase + (maxDepth * maxDepth)))
+                {
+                    METRICS_LATE_MOVE_PRUNE_INCREMENT(CollectMetrics, m_metrics, 1);
 
-                std::pair<Move, int> moveResult = SearchPositionPruned(board, maxDepth - 1, alpha, beta);
+                    continue;
+                }
 
-                if (moveResult.second > bestEval)
+                if (m_parameters.historyPruning &&
+                    maxDepth <= m_parameters.historyPruningMaxDepth &&
+                    historyScore < -(m_parameters.historyPruningMargin * maxDepth))
                 {
-                    bestMove = move;
-                    bestEval = moveResult.second;
+                    METRICS_HISTORY_PRUNE_INCREMENT(CollectMetrics, m_metrics, 1);
+
+                    continue;
                 }
+            }
 
-                board.UndoMove(moveInverse);
+            // Whether the move gives check is found without making it, so that pruned moves are never made
+            const bool givesCheck = MoveGenerator::GivesCheck(board, move);
 
-                if (bestEval >= beta)
-                    break;
+            // Futility pruning, skip the quiet moves which don't give check (always searching at least one move)
+            if (isFutile && isQuiet && !givesCheck && moveIndex > 0)
+            {
+                METRICS_FUTILITY_PRUNE_INCREMENT(CollectMetrics, m_metrics, 1);
 
-                alpha = std::max(alpha, bestEval);
+                continue;
             }
-        }
-        else
-        {
-            bestEval = std::numeric_limits<int>::max();
 
-            for (const Move& move : moveList)
+            MoveInverse moveInverse(board, move);
+            board.MakeMove(move);
+
+            // Late move reductions, the moves are ordered so that those late in the list are unlikely to beat alpha. So
+            // quiet moves late in the list (which don't give check) are first searched to a reduced depth, only if they
+            // beat alpha are they searched again to the full depth.
+            int reduction = 0;
+            if (m_parameters.lateMoveReductions &&
+                maxDepth >= m_parameters.lmrMinDepth &&
+                moveIndex >= m_parameters.lmrMinMoveIndex &&
+                isQuiet &&
+                !isInCheck &&
+                !givesCheck)
+            {
+                reduction = GetLateMoveReduction(maxDepth, moveIndex, historyScore);
+            }
+
+            // Principal variation search (https://www.chessprogramming.org/Principal_Variation_Search), the first move
+            // is expected to be the best so is searched with the full window. The other moves are searched with a zero
+            // window, which only proves that they don't beat alpha (and is cheaper to search), and are searched again
+            // with the full window if they do beat alpha.
+            int eval = 0;
+            if (moveIndex == 0)
+            {
+                eval = -SearchPositionPruned(board, maxDepth - 1, ply + 1, -beta, -alpha).second;
+            }
+            else
+            {
+                if (reduction > 0)
+                {
+                    METRICS_LMR_REDUCTION_INCREMENT(CollectMetrics, m_metrics, 1);
+                }
+
+                eval = -SearchPositionPruned(board, static_cast<unsigned char>(maxDepth - 1 - reduction), ply + 1, -alpha - 1, -alpha).second;
+
+                if (reduction > 0 && eval > alpha && !m_isStopping)
+                {
+                    METRICS_LMR_RESEARCH_INCREMENT(CollectMetrics, m_metrics, 1);
+
+                    eval = -SearchPositionPruned(board, maxDepth - 1, ply + 1, -alpha - 1, -alpha).second;
+                }
+
+                if (eval > alpha && eval < beta && !m_isStopping)
+                {
+                    METRICS_PVS_RESEARCH_INCREMENT(CollectMetrics, m_metrics, 1);
+
+                    eval = -SearchPositionPruned(board, maxDepth - 1, ply + 1, -beta, -alpha).second;
+                }
+            }
+
+            board.UndoMove(moveInverse);
+
+            moveIndex++;
+
+            // The search ran out of time so the eval can't be trusted, unwind without storing anything
+            if (m_isStopping)
             {
-                MoveInverse moveInverse(board, move);
-                board.MakeMove(move);
+                return std::pair<Move, int>(Move(), 0);
+            }
 
-                std::pair<Move, int> moveResult = SearchPositionPruned(board, maxDepth - 1, alpha, beta);
+            if (eval > bestEval)
+            {
+                bestMove = move;
+                bestEval = eval;
 
-                if (moveResult.second < bestEval)
+                if (isPvNode && eval > alpha)
                 {
-                    bestMove = move;
-                    bestEval = moveResult.second;
+                    UpdatePrincipalVariation(ply, move);
                 }
+            }
 
-                board.UndoMove(moveInverse);
+            alpha = std::max(alpha, bestEval);
 
-                if (bestEval <= alpha)
-                    break;
+            if (alpha >= beta)
+            {
+                // Quiet moves which cause a cutoff are likely to cause cutoffs in similar positions, so search them earlier
+                if (isQuiet)
+                {
+                    m_history.UpdateQuietCutoff(board, maxDepth, ply, move, quietsSearched, previousMoves);
+                }
 
-                beta = std::min(beta, bestEval);
+                break;
+            }
+
+            if (isQuiet)
+            {
+                quietsSearched.push_back(move);
             }
         }
 
+        // Store the result of the search, noting whether the evaluation is exact or only a bound
+        TranspositionTableEntry::Bound bound = TranspositionTableEntry::Bound::Exact;
+        if (bestEval <= alphaOriginal)
+        {
+            bound = TranspositionTableEntry::Bound::Upper;
+        }
+        else if (bestEval >= beta)
+        {
+            bound = TranspositionTableEntry::Bound::Lower;
+        }
+
+        m_transpositionTable.Store(board.GetHash(), maxDepth, bound, ToTranspositionEval(bestEval, ply), bestMove);
+
         return std::pair<Move, int>(bestMove, bestEval);
     }
 
-    MoveList Search::SortMoves(const MoveList& moveList)
+    int Search::GetLateMoveReduction(const unsigned char depth, const size_t moveIndex, const int historyScore) const
     {
-        const auto& comp = [](const Move& move1, const Move& move2) -> bool
+        int reduction = m_reductions[std::min<size_t>(depth, ReductionTableSize - 1)][std::min(moveIndex, ReductionTableSize - 1)];
+
+        // Reduce moves with a good history less, and those with a bad history more
+        reduction -= historyScore / m_parameters.lmrHistoryDivisor;
+
+        // Always search at least one ply deeper, so the reduced search doesn't drop straight into the quiescence search
+        return std::clamp(reduction, 0, std::max(depth - 2, 0));
+    }
+
+    bool Search::HasNonPawnMaterial(const Board& board)
+    {
+        const bool isWhite = board.GetWhiteToPlay();
+
+        return (board.GetColourBitboard(isWhite) &
+            ~(board.GetBitboard(Piece::Type::Pawn, isWhite) | board.GetBitboard(Piece::Type::King, isWhite))) != 0;
+    }
+
+    PreviousMoves Search::GetPreviousMoves(const unsigned char ply) const
+    {
+        PreviousMoves previousMoves;
+
+        for (size_t i = 0; i < previousMoves.size() && i < ply; i++)
         {
-            if (move1.IsPromotion() && !move2.IsPromotion())
+            previousMoves[i] = m_searchStack[ply - 1 - i];
+        }
+
+        return previousMoves;
+    }
+
+    void Search::UpdatePrincipalVariation(const unsigned char ply, const Move move)
+    {
+        MoveList& principalVariation = m_pvTable[ply];
+
+        principalVariation.clear();
+        principalVariation.push_back(move);
+
+        for (const Move& nextMove : m_pvTable[ply + 1])
+        {
+            principalVariation.push_back(nextMove);
+        }
+    }
+
+    Move Search::GetPrincipalVariationMove(const unsigned char ply) const
+    {
+        if (ply >= m_principalVariation.size())
+        {
+            return Move();
+        }
+
+        for (size_t i = 0; i < ply; i++)
+        {
+            if (m_searchStack[i].move != m_principalVariation[i])
             {
-                return true;
+                return Move();
             }
+        }
+
+        return m_principalVariation[ply];
+    }
+
+    int Search::ToTranspositionEval(const int eval, const unsigned char ply)
+    {
+        // The checkmate is one ply closer to this position than it is to the root for each ply this position is from the root
+        if (eval > CheckmateBound)
+        {
+            return eval + ply;
+        }
+        else if (eval < -CheckmateBound)
+        {
+            return eval - ply;
+        }
+
+        return eval;
+    }
 
-            if (move1.IsCapture() && !move2.IsCapture())
+    int Search::FromTranspositionEval(const int eval, const unsigned char ply)
+    {
+        if (eval > CheckmateBound)
+        {
+            return eval - ply;
+        }
+        else if (eval < -CheckmateBound)
+        {
+            return eval + ply;
+        }
+
+        return eval;
+    }
+
+    int Search::Evaluate(const Board& board)
+    {
+        METRICS_EVALUATION_START(CollectMetrics, m_metrics);
+
+        const int eval = m_evaluator.Evaluate(board);
+
+        METRICS_EVALUATION_STOP(CollectMetrics, m_metrics);
+        METRICS_EVALUATION_INCREMENT(CollectMetrics, m_metrics, 1);
+
+        return eval;
+    }
+
+    int Search::SearchQuiescence(Board& board, const unsigned char ply, int alpha, int beta)
+    {
+        METRICS_QUIESCENCE_INCREMENT(CollectMetrics, m_metrics, 1);
+
+        if (IsStopping())
+        {
+            return 0;
+        }
+
+        // When in check every move must be searched as the player may not be able to 'stand pat' (the
+        // position may be lost), otherwise only the captures and promotions are searched
+        const bool isInCheck = MoveGenerator::IsInCheck(board);
+
+        int standPat = -Infinity;
+        if (!isInCheck)
+        {
+            standPat = Evaluate(board);
+
+            // Assume that the player to move can do at least as well as the static evaluation by
+            // making a quiet move (null move observation), so they don't have to make a capture
+            if (standPat >= beta)
             {
-                return true;
+                return standPat;
             }
 
-            if ((move1.IsKingsideCastles() || move1.IsQueensideCastles()) &&
-                !(move2.IsKingsideCastles() || move2.IsQueensideCastles()))
+            alpha = std::max(alpha, standPat);
+        }
+
+        METRICS_GENERATION_START(CollectMetrics, m_metrics);
+
+        MoveList moveList;
+        MoveGenerator::GenerateMoves(
+            board,
+            moveList,
+            (isInCheck ? MoveGenerator::Mode::All : MoveGenerator::Mode::CapturesAndPromotions));
+        MovePicker movePicker(moveList, board, Move());
+
+        METRICS_GENERATION_STOP(CollectMetrics, m_metrics);
+        METRICS_GENERATION_INCREMENT(CollectMetrics, m_metrics, static_cast<int>(moveList.size()));
+
+        // With no legal moves while in check the player to move has been checkmated
+        if (isInCheck && moveList.empty())
+        {
+            return -CheckmateEval + ply;
+        }
+
+        int bestEval = standPat;
+
+        while (movePicker.HasNext())
+        {
+            const Move move = movePicker.PickNext();
+
+            // Delta pruning, skip captures which can't raise the evaluation to alpha even when winning the captured piece
+            // for free. This isn't done for promotions as the value gained from promoting is not accounted for.
+            if (!isInCheck && !move.IsPromotion())
             {
-                return true;
+                const Piece captured = board.GetPieces()[move.GetDestSquare()];
+                const int capturedValue = (move.IsEnPassantCapture()
+                    ? BoardEvaluator::GetPieceValue(Piece::Type::Pawn)
+                    : BoardEvaluator::GetPieceValue(captured.GetType()));
+
+                if (standPat + capturedValue + DeltaPruningMargin <= alpha)
+                {
+                    METRICS_QUIESCENCE_DELTA_PRUNE_INCREMENT(CollectMetrics, m_metrics, 1);
+
+                    continue;
+                }
+
+                // Skip captures which lose material, the player to move would do better to stand pat
+                if (StaticExchange::SEE(board, move) < 0)
+                {
+                    METRICS_QUIESCENCE_SEE_PRUNE_INCREMENT(CollectMetrics, m_metrics, 1);
+
+                    continue;
+                }
             }
 
-            return false;
-        };
+            MoveInverse moveInverse(board, move);
+            board.MakeMove(move);
 
-        MoveList sorted;
+            const int eval = -SearchQuiescence(board, ply + 1, -beta, -alpha);
 
-        for (const auto& move : moveList)
-        {
-            sorted.insert(
-                std::find_if(
-                    sorted.cbegin(),
-                    sorted.cend(),
-                    [&comp, &move](const Move& curr) -> bool { return comp(move, curr); }),
-                move);
+            board.UndoMove(moveInverse);
+
+            if (m_isStopping)
+            {
+                return 0;
+            }
+
+            bestEval = std::max(bestEval, eval);
+            alpha = std::max(alpha, bestEval);
+
+            if (alpha >= beta)
+                break;
         }
 
-        return sorted;
+        return bestEval;
     }
 }
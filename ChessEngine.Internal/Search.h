@@ -1,34 +1,209 @@
 #pragma once
 
+#include <functional>
+#include <vector>
+
 #include "BoardEvaluator.h"
+#include "MoveList.h"
+#include "SearchHistory.h"
 #include "SearchMetrics.h"
+#include "TimeManager.h"
+#include "TranspositionTable.h"
 
 namespace ChessEngine
 {
     class Board;
     class Move;
 
+    // The tunable parameters of the search, these allow the search to be measured with and without each technique
+    struct SearchParameters
+    {
+        // Late move reductions (https://www.chessprogramming.org/Late_Move_Reductions), a quiet move which doesn't
+        // give check and is ordered late is searched to a reduced depth of (base + ln(depth) * ln(move index) / divisor),
+        // less the move's history score over the history divisor. The move is re-searched to the full depth if it
+        // beats alpha at the reduced depth.
+        bool lateMoveReductions = true;         // Whether late move reductions are used
+        double lmrBase = 0.75;                  // The base reduction
+        double lmrDivisor = 2.25;               // The divisor of the logarithmic reduction, lower values reduce more
+        int lmrHistoryDivisor = 8'192;          // The history score which reduces the reduction by one ply
+        unsigned char lmrMinDepth = 3;          // The minimum depth at which moves are reduced
+        unsigned char lmrMinMoveIndex = 3;      // The number of moves searched to the full depth before moves are reduced
+
+        // Reverse futility pruning (https://www.chessprogramming.org/Reverse_Futility_Pruning), near the leaves a
+        // position whose static evaluation beats beta by more than the margin (per ply of depth) is cut off
+        bool reverseFutilityPruning = true;     // Whether reverse futility pruning is used
+        int reverseFutilityMargin = 120;        // The margin per ply of depth
+        unsigned char reverseFutilityMaxDepth = 3;  // The maximum depth at which positions are pruned
+
+        // Futility pruning (https://www.chessprogramming.org/Futility_Pruning), near the leaves the quiet moves (which
+        // don't give check) of a position whose static evaluation is more than the margin (per ply of depth) below
+        // alpha are skipped, as they are very unlikely to raise the evaluation enough to beat alpha
+        bool futilityPruning = true;            // Whether futility pruning is used
+        int futilityMargin = 100;               // The margin per ply of depth
+        unsigned char futilityMaxDepth = 3;     // The maximum depth at which moves are pruned
+
+        // Razoring (https://www.chessprogramming.org/Razoring), near the leaves a position whose static evaluation is
+        // more than the margin (per ply of depth) below alpha drops into the quiescence search, and is cut off if the
+        // quiescence search confirms that it can't beat alpha
+        bool razoring = true;                   // Whether razoring is used
+        int razoringMargin = 300;               // The margin per ply of depth
+        unsigned char razoringMaxDepth = 2;     // The maximum depth at which positions are razored
+
+        // Late move pruning (https://www.chessprogramming.org/Futility_Pruning#MoveCountBasedPruning), near the leaves
+        // the quiet moves are skipped once (base + depth * depth) moves have been searched
+        bool lateMovePruning = true;            // Whether late move pruning is used
+        int lmpBase = 3;                        // The number of moves searched (in addition to depth * depth) before pruning
+        unsigned char lmpMaxDepth = 3;          // The maximum depth at which moves are pruned
+
+        // History pruning, near the leaves the quiet moves with a history score below -(margin * depth) are skipped
+        bool historyPruning = true;             // Whether history pruning is used
+        int historyPruningMargin = 24;          // The margin per ply of depth
+        unsigned char historyPruningMaxDepth = 2;   // The maximum depth at which moves are pruned
+    };
+
+    // One of the best lines found for a position, the evaluation is +ve for white and -ve for black
+    struct SearchLine
+    {
+        Move move;                      // The first move of the line
+        int eval = 0;                   // The evaluation of the line
+        MoveList principalVariation;    // The principal variation of the line (starting with the move)
+    };
+
     class Search
     {
     public:
 
+        // The evaluation of checkmating the opponent, less one for each ply from the root to the checkmate so that
+        // shorter checkmates are preferred (and longer ones when being checkmated)
+        constexpr static int CheckmateEval = 100'000;
+
+        // Evaluations beyond this bound (in either direction) are checkmates found by the search rather than static evaluations
+        constexpr static int CheckmateBound = CheckmateEval - static_cast<int>(SearchHistory::MaxPly);
+
+        // Get whether an evaluation is a checkmate (for either player)
+        static bool IsCheckmateEval(const int eval) { return (eval > CheckmateBound || eval < -CheckmateBound); }
+
+        // Get the number of ply from the root to the checkmate for a checkmate evaluation
+        static int GetCheckmateDistance(const int eval) { return CheckmateEval - (eval < 0 ? -eval : eval); }
+
+        // Create a new search with the given parameters
+        Search(const SearchParameters& parameters = SearchParameters());
+
+        // Get the parameters of the search
+        const SearchParameters& GetParameters() const { return m_parameters; }
+
+        // Set the parameters of the search
+        void SetParameters(const SearchParameters& parameters);
+
         // Search a position to a given depth for the 'best move' in the position
         std::pair<Move, int> SearchPosition(Board& board, const unsigned char maxDepth);
 
+        // Search a position for the 'best move' in the position using iterative deepening until either the max
+        // depth is reached or the time allocated runs out, returning the best move of the last completed iteration
+        std::pair<Move, int> SearchPosition(Board& board, const SearchLimits& limits);
+
+        // Get the depth of the last completed iteration of the previous search
+        unsigned char GetCompletedDepth() const { return m_completedDepth; }
+
+        // A function called with the lines found by each completed iteration of iterative deepening (and its depth)
+        using IterationReporter = std::function<void(const unsigned char depth, const std::vector<SearchLine>& lines)>;
+
+        // Set the function called with the lines found by each completed iteration, so that the progress of a search can be reported
+        void SetIterationReporter(IterationReporter reporter) { m_iterationReporter = std::move(reporter); }
+
+        // Get the best lines (best first) found by the last completed iteration of the previous search, there is one line
+        // unless more were asked for by the search limits (and there are fewer if there are fewer legal moves)
+        const std::vector<SearchLine>& GetLines() const { return m_lines; }
+
+        // Get the principal variation (the line of best play for both players, starting with the best move) found by
+        // the last completed iteration of the previous search
+        const MoveList& GetPrincipalVariation() const { return m_principalVariation; }
+
     private:
 
-        // Search a position to a given depth using an 'alpha-beta' style pruning search algorithm
+        // Check whether the search has run out of time, this is only checked every so many positions
+        bool IsStopping();
+
+        // Search the root position to a given depth with an aspiration window around the previous iteration's evaluation
+        std::pair<Move, int> SearchRootAspiration(Board& board, const unsigned char depth, const int previousEval);
+
+        // Search the root position to a given depth for the given number of best lines (MultiPV), each move is searched with
+        // alpha at the evaluation of the Nth best line found so far. The evaluations are from the perspective of the player to move.
+        std::vector<SearchLine> SearchRootLines(Board& board, const unsigned char depth, const unsigned char numLines);
+
+        // Search a position to a given depth using an 'alpha-beta' style pruning search algorithm,
+        // the evaluation returned is from the perspective of the player to move (negamax)
         std::pair<Move, int> SearchPositionPruned(
             Board& board,
             const unsigned char maxDepth,
+            const unsigned char ply,
             int alpha,
             int beta);
 
-        // Sort a list of moves based upon which look the most appealing for the given board
-        MoveList SortMoves(const MoveList& moveList);
+        // Get the late move reduction (in ply) for a quiet move searched at a given depth and index with a given history score
+        int GetLateMoveReduction(const unsigned char depth, const size_t moveIndex, const int historyScore) const;
+
+        // Determine whether the player to move has any pieces other than pawns and their king
+        static bool HasNonPawnMaterial(const Board& board);
+
+        // Get the moves made one and two ply before the position at the given ply of the line currently being searched
+        PreviousMoves GetPreviousMoves(const unsigned char ply) const;
+
+        // Convert a checkmate evaluation from being relative to the root to being relative to the position at the given ply
+        // before storing it in the transposition table, as the position may be reached at a different ply when probed
+        static int ToTranspositionEval(const int eval, const unsigned char ply);
+
+        // Convert a checkmate evaluation probed from the transposition table back to being relative to the root
+        static int FromTranspositionEval(const int eval, const unsigned char ply);
+
+        // Set the principal variation from the given ply to the given move followed by the principal variation from the next ply
+        void UpdatePrincipalVariation(const unsigned char ply, const Move move);
+
+        // Get the move of the previous iteration's principal variation at the given ply, if the line currently being searched
+        // has followed the principal variation so far (otherwise Move())
+        Move GetPrincipalVariationMove(const unsigned char ply) const;
+
+        // Get the static evaluation of a position from the perspective of the player to move
+        int Evaluate(const Board& board);
+
+        // Search only the captures and promotions of a position until it is quiet (also searching all the moves when in
+        // check) so that positions aren't evaluated part way through an exchange, the evaluation returned is from the
+        // perspective of the player to move (negamax). See https://www.chessprogramming.org/Quiescence_Search
+        int SearchQuiescence(Board& board, const unsigned char ply, int alpha, int beta);
+
+        constexpr static size_t ReductionTableSize = 64;   // The number of depths and move indices in the reduction table
+
+        SearchParameters m_parameters;  // The tunable parameters of the search
+
+        // The late move reductions (in ply), indexed by [depth][move index] (each clamped to the size of the table)
+        std::array<std::array<unsigned char, ReductionTableSize>, ReductionTableSize> m_reductions{};
 
         BoardEvaluator m_evaluator; // The board evaluator used to evaluate positions during search
 
+        TranspositionTable m_transpositionTable;    // The transposition table used to store the results of previous searches
+
+        SearchHistory m_history;    // The killer moves, counter moves and history scores used to order quiet moves
+
+        std::array<PlayedMove, SearchHistory::MaxPly> m_searchStack;    // The move made at each ply of the line currently being searched
+
+        // The triangular principal variation table, holding the principal variation found from each ply of the line
+        // currently being searched (each is built from the move played and the principal variation from the next ply)
+        std::vector<MoveList> m_pvTable;
+
+        MoveList m_principalVariation;  // The principal variation of the last completed iteration
+
+        std::vector<SearchLine> m_lines;    // The best lines found by the last completed iteration
+
+        IterationReporter m_iterationReporter;  // The function called with the lines found by each completed iteration (if set)
+
         SearchMetrics m_metrics;    // The metrics collected during the search
+
+        TimeManager m_timeManager;  // The time manager deciding how long to search for
+
+        bool m_isStopping = false;  // Whether the search has run out of time and is unwinding
+
+        unsigned int m_positionsUntilTimeCheck = 0;   // The number of positions to search before next checking the time
+
+        unsigned char m_completedDepth = 0; // The depth of the last completed iteration
     };
 }
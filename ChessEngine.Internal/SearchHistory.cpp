@@ -0,0 +1,132 @@
+#include "pch.h"
+
+#include "SearchHistory.h"
+
+#include "Board.h"
+
+namespace ChessEngine
+{
+    namespace
+    {
+        // The maximum bonus applied to the history score of a move for a single cutoff
+        constexpr int MaxHistoryBonus = 1'200;
+    }
+
+    SearchHistory::SearchHistory()
+    {
+        for (std::vector<int>& continuationHistory : m_continuationHistory)
+        {
+            continuationHistory.resize(NumPieceSquares * NumPieceSquares);
+        }
+
+        Clear();
+    }
+
+    int SearchHistory::GetQuietScore(const bool isWhite, const PlayedMove& current, const PreviousMoves& previousMoves) const
+    {
+        return (
+            GetHistory(isWhite, current.move) +
+            GetContinuationHistory(previousMoves[0], 1, current) +
+            GetContinuationHistory(previousMoves[1], 2, current));
+    }
+
+    void SearchHistory::UpdateQuietCutoff(
+        const Board& board,
+        const unsigned char depth,
+        const unsigned char ply,
+        const Move move,
+        const MoveList& quietsSearched,
+        const PreviousMoves& previousMoves)
+    {
+        // Keep the killers distinct, with the most recent first
+        std::array<Move, NumKillers>& killers = m_killers[ply];
+        if (killers[0] != move)
+        {
+            std::copy_backward(killers.begin(), killers.end() - 1, killers.end());
+            killers[0] = move;
+        }
+
+        if (previousMoves[0].move != Move())
+        {
+            m_counterMoves[GetPieceSquareIndex(previousMoves[0])] = move;
+        }
+
+        // Cutoffs found deeper in the tree are more significant as they prune more positions
+        const int bonus = std::min(depth * depth, MaxHistoryBonus);
+        const bool isWhite = board.GetWhiteToPlay();
+
+        UpdateHistories(isWhite, { move, board.GetPieces()[move.GetInitSquare()] }, previousMoves, bonus);
+
+        for (const Move& quiet : quietsSearched)
+        {
+            if (quiet != move)
+            {
+                UpdateHistories(isWhite, { quiet, board.GetPieces()[quiet.GetInitSquare()] }, previousMoves, -bonus);
+            }
+        }
+    }
+
+    void SearchHistory::Age()
+    {
+        for (auto& killers : m_killers)
+        {
+            killers.fill(Move());
+        }
+
+        for (auto& sideHistory : m_history)
+        {
+            for (auto& initHistory : sideHistory)
+            {
+                for (int& history : initHistory)
+                {
+                    history /= 2;
+                }
+            }
+        }
+
+        for (std::vector<int>& continuationHistory : m_continuationHistory)
+        {
+            for (int& history : continuationHistory)
+            {
+                history /= 2;
+            }
+        }
+    }
+
+    void SearchHistory::Clear()
+    {
+        for (auto& killers : m_killers)
+        {
+            killers.fill(Move());
+        }
+
+        m_counterMoves.fill(Move());
+
+        std::fill_n(&m_history[0][0][0], (2 * 64 * 64), 0);
+
+        for (std::vector<int>& continuationHistory : m_continuationHistory)
+        {
+            std::fill(continuationHistory.begin(), continuationHistory.end(), 0);
+        }
+    }
+
+    void SearchHistory::UpdateHistory(int& history, const int bonus)
+    {
+        // The 'history gravity' formula, this keeps the score within [-MaxHistory, +MaxHistory]
+        // while letting moves whose scores are large be overtaken by those which cut off recently
+        history += bonus - (history * std::abs(bonus) / MaxHistory);
+    }
+
+    void SearchHistory::UpdateHistories(const bool isWhite, const PlayedMove& current, const PreviousMoves& previousMoves, const int bonus)
+    {
+        UpdateHistory(m_history[isWhite ? 0 : 1][current.move.GetInitSquare()][current.move.GetDestSquare()], bonus);
+
+        for (size_t i = 0; i < previousMoves.size(); i++)
+        {
+            if (previousMoves[i].move != Move())
+            {
+                UpdateHistory(m_continuationHistory[i][GetContinuationIndex(previousMoves[i], current)], bonus);
+            }
+        }
+    }
+}
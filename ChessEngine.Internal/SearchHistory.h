@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Definitions.h"
+#include "Move.h"
+#include "MoveList.h"
+#include "Piece.h"
+
+namespace ChessEngine
+{
+    // A move made in the line currently being searched, along with the piece which made it
+    struct PlayedMove
+    {
+        Move move;      // The move made (Move() if there is no such move, ex. before the root)
+        Piece piece;    // The piece which made the move
+    };
+
+    // The moves made one and two ply before a position in the line currently being searched
+    using PreviousMoves = std::array<PlayedMove, 2>;
+
+    // The tables used to order quiet moves during a search, based upon which quiet moves caused beta cutoffs
+    // earlier in the search. See https://www.chessprogramming.org/Killer_Heuristic,
+    // https://www.chessprogramming.org/History_Heuristic and https://www.chessprogramming.org/Countermove_Heuristic
+    // for more details.
+    class SearchHistory
+    {
+    public:
+
+        constexpr static size_t MaxPly = 256;       // The maximum number of ply from the root (the ply is an unsigned char)
+        constexpr static size_t NumKillers = 2;     // The number of killer moves stored for each ply
+        constexpr static int MaxHistory = 16'384;   // The bound on the magnitude of a history score (in each table)
+
+        // Create a new (empty) search history
+        SearchHistory();
+
+        // Get the killer moves for a given ply (quiet moves which recently caused a cutoff at that ply), most recent first
+        const std::array<Move, NumKillers>& GetKillers(const unsigned char ply) const { return m_killers[ply]; }
+
+        // Get the quiet move which most recently caused a cutoff in reply to a given move (Move() if there is none)
+        Move GetCounterMove(const PlayedMove& previous) const
+        {
+            return (previous.move != Move() ? m_counterMoves[GetPieceSquareIndex(previous)] : Move());
+        }
+
+        // Get the (butterfly) history score of a quiet move for a given player
+        int GetHistory(const bool isWhite, const Move move) const
+        {
+            return m_history[isWhite ? 0 : 1][move.GetInitSquare()][move.GetDestSquare()];
+        }
+
+        // Get the continuation history score of a quiet move (made by the given piece) following a move made the
+        // given number of ply earlier (1 or 2), this is zero if there was no such move
+        int GetContinuationHistory(const PlayedMove& previous, const size_t plyBack, const PlayedMove& current) const
+        {
+            return (previous.move != Move() ? m_continuationHistory[plyBack - 1][GetContinuationIndex(previous, current)] : 0);
+        }
+
+        // Get the combined history score of a quiet move (made by the given piece) following the previous moves
+        int GetQuietScore(const bool isWhite, const PlayedMove& current, const PreviousMoves& previousMoves) const;
+
+        // Update the tables after a quiet move caused a beta cutoff at a given depth and ply, the quiet moves
+        // which were searched before it (and so failed to cause a cutoff) have their history scores reduced
+        void UpdateQuietCutoff(
+            const Board& board,
+            const unsigned char depth,
+            const unsigned char ply,
+            const Move move,
+            const MoveList& quietsSearched,
+            const PreviousMoves& previousMoves);
+
+        // Age the tables between searches, the killers are cleared and the history scores halved so that the
+        // history from previous searches still helps ordering but is quickly outweighed by the current search
+        void Age();
+
+        // Clear all the tables
+        void Clear();
+
+    private:
+
+        constexpr static size_t NumPieceSquares = Piece::NumIndices * 64;  // The number of (piece, destination square) pairs
+
+        // Get the index of the (piece, destination square) pair of a move
+        static size_t GetPieceSquareIndex(const PlayedMove& played)
+        {
+            return (played.piece.GetIndex() * 64) + played.move.GetDestSquare();
+        }
+
+        // Get the index of the (previous piece, previous destination, current piece, current destination) continuation
+        static size_t GetContinuationIndex(const PlayedMove& previous, const PlayedMove& current)
+        {
+            return (GetPieceSquareIndex(previous) * NumPieceSquares) + GetPieceSquareIndex(current);
+        }
+
+        // Apply a bonus (or penalty if negative) to a history score, scaled down as the score nears the bound
+        static void UpdateHistory(int& history, const int bonus);
+
+        // Apply a bonus (or penalty if negative) to all the history scores of a quiet move
+        void UpdateHistories(const bool isWhite, const PlayedMove& current, const PreviousMoves& previousMoves, const int bonus);
+
+        std::array<std::array<Move, NumKillers>, MaxPly> m_killers; // The killer moves for each ply
+
+        std::array<Move, NumPieceSquares> m_counterMoves;   // The counter moves, indexed by the (piece, destination square) of the previous move
+
+        int m_history[2][64][64];   // The history scores of quiet moves, indexed by [player][init square][dest square]
+
+        // The one and two ply continuation history scores of quiet moves, indexed by the (piece, destination square) of the
+        // earlier move and then of the current move. These are large so are allocated on the heap.
+        std::array<std::vector<int>, 2> m_continuationHistory;
+    };
+}
@@ -2,6 +2,7 @@
 
 #include "SearchMetrics.h"
 
+#include "Attacks.h"
 #include "Global.h"
 
 namespace
@@ -19,16 +20,44 @@ namespace ChessEngine
             << "==========================" << "\n"
             << "    Total searched positions: " << m_searchTotalPositions << "\n"
             << "    Total time searching: " << m_searchTotalTime.count() << " seconds" << "\n"
+            << "    Total draws: " << m_searchTotalDraws << "\n"
+            << "\n"
+            << "Quiescence" << "\n"
+            << "==========" << "\n"
+            << "    Total searched positions: " << m_quiescenceTotalPositions << "\n"
+            << "    Total delta prunes: " << m_quiescenceTotalDeltaPrunes << "\n"
+            << "    Total SEE prunes: " << m_quiescenceTotalSeePrunes << "\n"
+            << "\n"
+            << "Pruning" << "\n"
+            << "=======" << "\n"
+            << "    Total mate distance cutoffs: " << m_pruningTotalMateDistanceCutoffs << "\n"
+            << "    Total null move cutoffs: " << m_pruningTotalNullMoveCutoffs << "\n"
+            << "    Total late move reductions: " << m_pruningTotalLateMoveReductions << "\n"
+            << "    Total late move re-searches: " << m_pruningTotalLateMoveResearches << "\n"
+            << "    Total PVS re-searches: " << m_pruningTotalPvsResearches << "\n"
+            << "    Total aspiration re-searches: " << m_pruningTotalAspirationResearches << "\n"
+            << "    Total reverse futility cutoffs: " << m_pruningTotalReverseFutilityCutoffs << "\n"
+            << "    Total razoring cutoffs: " << m_pruningTotalRazoringCutoffs << "\n"
+            << "    Total futility prunes: " << m_pruningTotalFutilityPrunes << "\n"
+            << "    Total late move prunes: " << m_pruningTotalLateMovePrunes << "\n"
+            << "    Total history prunes: " << m_pruningTotalHistoryPrunes << "\n"
             << "\n"
             << "Generation" << "\n"
             << "==========" << "\n"
             << "    Total generated positions: " << m_generationTotalPositions << "\n"
             << "    Total time generating: " << m_generationTotalTime.count() << " seconds" << "\n"
+            << "    Slider attacks backend: " << Attacks::GetBackendName(Attacks::GetBackend())
+            << " (BMI2 " << (Attacks::IsPextSupported() ? "supported" : "not supported") << ")" << "\n"
             << "\n"
             << "Evaluation" << "\n"
             << "==========" << "\n"
             << "    Total evaluated positions: " << m_evaluationTotalPositions << "\n"
             << "    Total time evaluating: " << m_evaluationTotalTime.count() << " seconds" << "\n"
+            << "\n"
+            << "Transposition Table" << "\n"
+            << "===================" << "\n"
+            << "    Total hits: " << m_transpositionTotalHits << "\n"
+            << "    Total cutoffs: " << m_transpositionTotalCutoffs << "\n"
             << "\n";
 
         std::cout << ss.str();
@@ -37,6 +66,7 @@ namespace ChessEngine
 
     void WriteHeaders(std::ofstream& fs)
     {
+        // New columns are always appended, as the headers are only written when the file is created
         fs  << "Version,"
             << "Max Depth,"
             << "Total Search Positions,"
@@ -45,6 +75,24 @@ namespace ChessEngine
             << "Total Time Generating,"
             << "Total Evaluated Positions,"
             << "Total Time Evaluating,"
+            << "Total Transposition Hits,"
+            << "Total Transposition Cutoffs,"
+            << "Attacks Backend,"
+            << "Total Quiescence Positions,"
+            << "Total Delta Prunes,"
+            << "Total Null Move Cutoffs,"
+            << "Total Late Move Reductions,"
+            << "Total Late Move Re-searches,"
+            << "Total PVS Re-searches,"
+            << "Total Aspiration Re-searches,"
+            << "Total Reverse Futility Cutoffs,"
+            << "Total Razoring Cutoffs,"
+            << "Total Futility Prunes,"
+            << "Total Late Move Prunes,"
+            << "Total History Prunes,"
+            << "Total SEE Prunes,"
+            << "Total Draws,"
+            << "Total Mate Distance Cutoffs,"
             << std::endl;
     }
 
@@ -77,6 +125,24 @@ namespace ChessEngine
             << m_generationTotalTime.count() << ","
             << m_evaluationTotalPositions << ","
             << m_evaluationTotalTime.count() << ","
+            << m_transpositionTotalHits << ","
+            << m_transpositionTotalCutoffs << ","
+            << Attacks::GetBackendName(Attacks::GetBackend()) << ","
+            << m_quiescenceTotalPositions << ","
+            << m_quiescenceTotalDeltaPrunes << ","
+            << m_pruningTotalNullMoveCutoffs << ","
+            << m_pruningTotalLateMoveReductions << ","
+            << m_pruningTotalLateMoveResearches << ","
+            << m_pruningTotalPvsResearches << ","
+            << m_pruningTotalAspirationResearches << ","
+            << m_pruningTotalReverseFutilityCutoffs << ","
+            << m_pruningTotalRazoringCutoffs << ","
+            << m_pruningTotalFutilityPrunes << ","
+            << m_pruningTotalLateMovePrunes << ","
+            << m_pruningTotalHistoryPrunes << ","
+            << m_quiescenceTotalSeePrunes << ","
+            << m_searchTotalDraws << ","
+            << m_pruningTotalMateDistanceCutoffs << ","
             << "\n";
 
         fs.flush();
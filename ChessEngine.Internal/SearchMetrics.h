@@ -7,15 +7,40 @@
 #define METRICS_SEARCH_START(check, metrics) if constexpr (check) { metrics.SearchStart(); }
 #define METRICS_SEARCH_STOP(check, metrics)  if constexpr (check) { metrics.SearchStop();  }
 #define METRICS_SEARCH_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.SearchIncrementPositions(increment); }
+#define METRICS_SEARCH_DRAW_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.SearchIncrementDraws(increment); }
 
 #define METRICS_GENERATION_START(check, metrics) if constexpr (check) { metrics.GenerationStart(); }
 #define METRICS_GENERATION_STOP(check, metrics)  if constexpr (check) { metrics.GenerationStop();  }
 #define METRICS_GENERATION_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.GenerationIncrementPositions(increment); }
 
+#define METRICS_QUIESCENCE_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.QuiescenceIncrementPositions(increment); }
+#define METRICS_QUIESCENCE_DELTA_PRUNE_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.QuiescenceIncrementDeltaPrunes(increment); }
+#define METRICS_QUIESCENCE_SEE_PRUNE_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.QuiescenceIncrementSeePrunes(increment); }
+
+#define METRICS_MATE_DISTANCE_CUTOFF_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.PruningIncrementMateDistanceCutoffs(increment); }
+
+#define METRICS_NULL_MOVE_CUTOFF_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.PruningIncrementNullMoveCutoffs(increment); }
+
+#define METRICS_LMR_REDUCTION_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.PruningIncrementLateMoveReductions(increment); }
+#define METRICS_LMR_RESEARCH_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.PruningIncrementLateMoveResearches(increment); }
+
+#define METRICS_PVS_RESEARCH_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.PruningIncrementPvsResearches(increment); }
+#define METRICS_ASPIRATION_RESEARCH_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.PruningIncrementAspirationResearches(increment); }
+
+#define METRICS_REVERSE_FUTILITY_CUTOFF_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.PruningIncrementReverseFutilityCutoffs(increment); }
+#define METRICS_RAZORING_CUTOFF_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.PruningIncrementRazoringCutoffs(increment); }
+#define METRICS_FUTILITY_PRUNE_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.PruningIncrementFutilityPrunes(increment); }
+
+#define METRICS_LATE_MOVE_PRUNE_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.PruningIncrementLateMovePrunes(increment); }
+#define METRICS_HISTORY_PRUNE_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.PruningIncrementHistoryPrunes(increment); }
+
 #define METRICS_EVALUATION_START(check, metrics) if constexpr (check) { metrics.EvaluationStart(); }
 #define METRICS_EVALUATION_STOP(check, metrics)  if constexpr (check) { metrics.EvaluationStop();  }
 #define METRICS_EVALUATION_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.EvaluationIncrementPositions(increment); }
 
+#define METRICS_TRANSPOSITION_HIT_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.TranspositionIncrementHits(increment); }
+#define METRICS_TRANSPOSITION_CUTOFF_INCREMENT(check, metrics, increment) if constexpr (check) { metrics.TranspositionIncrementCutoffs(increment); }
+
 #define METRICS_PRINT(check, metrics) if constexpr (check) { metrics.PrintMetrics(); }
 #define METRICS_WRITE(check, metrics) if constexpr (check) { metrics.WriteMetrics(); }
 
@@ -53,6 +78,12 @@ namespace ChessEngine
             m_searchTotalPositions += increment;
         }
 
+        // Increment the total number of positions found to be drawn (by repetition, the fifty move rule or insufficient material)
+        void SearchIncrementDraws(int increment)
+        {
+            m_searchTotalDraws += increment;
+        }
+
         // Get the total time spent searching positions (seconds)
         std::chrono::duration<double> GetSearchTotalTime() const
         {
@@ -65,6 +96,180 @@ namespace ChessEngine
             return m_searchTotalPositions;
         }
 
+        // Get the total number of positions found to be drawn
+        int GetSearchTotalDraws() const
+        {
+            return m_searchTotalDraws;
+        }
+
+        // Increment the total number of positions searched by the quiescence search
+        void QuiescenceIncrementPositions(int increment)
+        {
+            m_quiescenceTotalPositions += increment;
+        }
+
+        // Get the total number of positions searched by the quiescence search
+        int GetQuiescenceTotalPositions() const
+        {
+            return m_quiescenceTotalPositions;
+        }
+
+        // Increment the total number of captures skipped by delta pruning in the quiescence search
+        void QuiescenceIncrementDeltaPrunes(int increment)
+        {
+            m_quiescenceTotalDeltaPrunes += increment;
+        }
+
+        // Get the total number of captures skipped by delta pruning in the quiescence search
+        int GetQuiescenceTotalDeltaPrunes() const
+        {
+            return m_quiescenceTotalDeltaPrunes;
+        }
+
+        // Increment the total number of positions cut off by mate distance pruning
+        void PruningIncrementMateDistanceCutoffs(int increment)
+        {
+            m_pruningTotalMateDistanceCutoffs += increment;
+        }
+
+        // Get the total number of positions cut off by mate distance pruning
+        int GetPruningTotalMateDistanceCutoffs() const
+        {
+            return m_pruningTotalMateDistanceCutoffs;
+        }
+
+        // Increment the total number of positions cut off by null move pruning
+        void PruningIncrementNullMoveCutoffs(int increment)
+        {
+            m_pruningTotalNullMoveCutoffs += increment;
+        }
+
+        // Get the total number of positions cut off by null move pruning
+        int GetPruningTotalNullMoveCutoffs() const
+        {
+            return m_pruningTotalNullMoveCutoffs;
+        }
+
+        // Increment the total number of moves searched to a reduced depth by late move reductions
+        void PruningIncrementLateMoveReductions(int increment)
+        {
+            m_pruningTotalLateMoveReductions += increment;
+        }
+
+        // Get the total number of moves searched to a reduced depth by late move reductions
+        int GetPruningTotalLateMoveReductions() const
+        {
+            return m_pruningTotalLateMoveReductions;
+        }
+
+        // Increment the total number of reduced moves which were searched again to the full depth
+        void PruningIncrementLateMoveResearches(int increment)
+        {
+            m_pruningTotalLateMoveResearches += increment;
+        }
+
+        // Get the total number of reduced moves which were searched again to the full depth
+        int GetPruningTotalLateMoveResearches() const
+        {
+            return m_pruningTotalLateMoveResearches;
+        }
+
+        // Increment the total number of moves searched again with the full window after beating alpha with a zero window
+        void PruningIncrementPvsResearches(int increment)
+        {
+            m_pruningTotalPvsResearches += increment;
+        }
+
+        // Get the total number of moves searched again with the full window after beating alpha with a zero window
+        int GetPruningTotalPvsResearches() const
+        {
+            return m_pruningTotalPvsResearches;
+        }
+
+        // Increment the total number of iterations searched again after failing outside of the aspiration window
+        void PruningIncrementAspirationResearches(int increment)
+        {
+            m_pruningTotalAspirationResearches += increment;
+        }
+
+        // Get the total number of iterations searched again after failing outside of the aspiration window
+        int GetPruningTotalAspirationResearches() const
+        {
+            return m_pruningTotalAspirationResearches;
+        }
+
+        // Increment the total number of positions cut off by reverse futility pruning
+        void PruningIncrementReverseFutilityCutoffs(int increment)
+        {
+            m_pruningTotalReverseFutilityCutoffs += increment;
+        }
+
+        // Get the total number of positions cut off by reverse futility pruning
+        int GetPruningTotalReverseFutilityCutoffs() const
+        {
+            return m_pruningTotalReverseFutilityCutoffs;
+        }
+
+        // Increment the total number of positions cut off by razoring
+        void PruningIncrementRazoringCutoffs(int increment)
+        {
+            m_pruningTotalRazoringCutoffs += increment;
+        }
+
+        // Get the total number of positions cut off by razoring
+        int GetPruningTotalRazoringCutoffs() const
+        {
+            return m_pruningTotalRazoringCutoffs;
+        }
+
+        // Increment the total number of quiet moves skipped by futility pruning
+        void PruningIncrementFutilityPrunes(int increment)
+        {
+            m_pruningTotalFutilityPrunes += increment;
+        }
+
+        // Get the total number of quiet moves skipped by futility pruning
+        int GetPruningTotalFutilityPrunes() const
+        {
+            return m_pruningTotalFutilityPrunes;
+        }
+
+        // Increment the total number of quiet moves skipped by late move pruning
+        void PruningIncrementLateMovePrunes(int increment)
+        {
+            m_pruningTotalLateMovePrunes += increment;
+        }
+
+        // Get the total number of quiet moves skipped by late move pruning
+        int GetPruningTotalLateMovePrunes() const
+        {
+            return m_pruningTotalLateMovePrunes;
+        }
+
+        // Increment the total number of quiet moves skipped by history pruning
+        void PruningIncrementHistoryPrunes(int increment)
+        {
+            m_pruningTotalHistoryPrunes += increment;
+        }
+
+        // Get the total number of quiet moves skipped by history pruning
+        int GetPruningTotalHistoryPrunes() const
+        {
+            return m_pruningTotalHistoryPrunes;
+        }
+
+        // Increment the total number of losing captures (by SEE) skipped in the quiescence search
+        void QuiescenceIncrementSeePrunes(int increment)
+        {
+            m_quiescenceTotalSeePrunes += increment;
+        }
+
+        // Get the total number of losing captures (by SEE) skipped in the quiescence search
+        int GetQuiescenceTotalSeePrunes() const
+        {
+            return m_quiescenceTotalSeePrunes;
+        }
+
         // Start recording the time spent generating positions
         void GenerationStart()
         { 
@@ -127,6 +332,30 @@ namespace ChessEngine
             return m_evaluationTotalPositions;
         }
 
+        // Increment the total number of positions found in the transposition table
+        void TranspositionIncrementHits(int increment)
+        {
+            m_transpositionTotalHits += increment;
+        }
+
+        // Get the total number of positions found in the transposition table
+        int GetTranspositionTotalHits() const
+        {
+            return m_transpositionTotalHits;
+        }
+
+        // Increment the total number of positions cut off by the transposition table
+        void TranspositionIncrementCutoffs(int increment)
+        {
+            m_transpositionTotalCutoffs += increment;
+        }
+
+        // Get the total number of positions cut off by the transposition table
+        int GetTranspositionTotalCutoffs() const
+        {
+            return m_transpositionTotalCutoffs;
+        }
+
         // Print a summary of the metrics to std::cout
         void PrintMetrics() const;
 
@@ -141,6 +370,23 @@ namespace ChessEngine
         std::chrono::time_point<std::chrono::system_clock> m_searchStop;
         std::chrono::duration<double> m_searchTotalTime{ 0.0 }; // The total time spend searching positions
         int m_searchTotalPositions = 0;                         // The total number of positions searched (<= number of positions generated)
+        int m_searchTotalDraws = 0;                             // The total number of positions found to be drawn
+
+        int m_quiescenceTotalPositions = 0;     // The total number of positions searched by the quiescence search
+        int m_quiescenceTotalDeltaPrunes = 0;   // The total number of captures skipped by delta pruning
+        int m_quiescenceTotalSeePrunes = 0;     // The total number of losing captures (by SEE) skipped
+
+        int m_pruningTotalMateDistanceCutoffs = 0;  // The total number of positions cut off by mate distance pruning
+        int m_pruningTotalNullMoveCutoffs = 0;      // The total number of positions cut off by null move pruning
+        int m_pruningTotalLateMoveReductions = 0;   // The total number of moves searched to a reduced depth
+        int m_pruningTotalLateMoveResearches = 0;   // The total number of reduced moves searched again (<= number of reductions)
+        int m_pruningTotalPvsResearches = 0;        // The total number of moves searched again with the full window
+        int m_pruningTotalAspirationResearches = 0; // The total number of iterations searched again with a wider window
+        int m_pruningTotalReverseFutilityCutoffs = 0;   // The total number of positions cut off by reverse futility pruning
+        int m_pruningTotalRazoringCutoffs = 0;          // The total number of positions cut off by razoring
+        int m_pruningTotalFutilityPrunes = 0;           // The total number of quiet moves skipped by futility pruning
+        int m_pruningTotalLateMovePrunes = 0;           // The total number of quiet moves skipped by late move pruning
+        int m_pruningTotalHistoryPrunes = 0;            // The total number of quiet moves skipped by history pruning
 
         std::chrono::time_point<std::chrono::system_clock> m_generationStart;
         std::chrono::time_point<std::chrono::system_clock> m_generationStop;
@@ -151,5 +397,8 @@ namespace ChessEngine
         std::chrono::time_point<std::chrono::system_clock> m_evaluationStop;
         std::chrono::duration<double> m_evaluationTotalTime{ 0.0 }; // The total time spent evaluating nodes (seconds)
         int m_evaluationTotalPositions = 0;                         // The total number of positions evaluated (<= number of positions searched)
+
+        int m_transpositionTotalHits = 0;       // The total number of positions found in the transposition table
+        int m_transpositionTotalCutoffs = 0;    // The total number of positions cut off by the transposition table (<= number of hits)
     };
 }
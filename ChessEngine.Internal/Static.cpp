@@ -46,4 +46,17 @@ namespace ChessEngine
         Piece::Type::Queen,
         Piece::Type::King
     };
+
+    // Lookup table mapping the underlying bitmap of a piece to its index
+    const std::array<uint8_t, 256> Piece::Indices = []() {
+        std::array<uint8_t, 256> indices{};
+
+        for (const auto& type : Piece::AllTypes)
+        {
+            indices[Piece(type, true).GetValue()] = static_cast<uint8_t>(Piece::IndexFromType(type, true));
+            indices[Piece(type, false).GetValue()] = static_cast<uint8_t>(Piece::IndexFromType(type, false));
+        }
+
+        return indices;
+    }();
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "pch.h"
+
+#include "StaticExchange.h"
+
+#include "Board.h"
+#include "BoardEvaluator.h"
+#include "Helper.h"
+#include "Move.h"
+#include "MoveGenerator.h"
+#include "Piece.h"
+
+namespace ChessEngine
+{
+    namespace
+    {
+        // The piece types in order of increasing value, the order in which the players capture with them
+        constexpr std::array<Piece::Type, 6> TypesByValue = {
+            Piece::Type::Pawn,
+            Piece::Type::Knight,
+            Piece::Type::Bishop,
+            Piece::Type::Rook,
+            Piece::Type::Queen,
+            Piece::Type::King
+        };
+
+        // The maximum number of captures on a single square (there are only 32 pieces)
+        constexpr size_t MaxCaptures = 32;
+    }
+
+    int StaticExchange::SEE(const Board& board, const Move move)
+    {
+        const Square init = move.GetInitSquare();
+        const Square dest = move.GetDestSquare();
+
+        Bitboard occupied = board.GetOccupiedBitboard() ^ Helper::SquareBitboard(init);
+
+        // The material won by each capture in the sequence, assuming that the piece making it is not recaptured
+        std::array<int, MaxCaptures> gains{};
+
+        if (move.IsEnPassantCapture())
+        {
+            gains[0] = BoardEvaluator::GetPieceValue(Piece::Type::Pawn);
+            occupied ^= Helper::SquareBitboard(static_cast<Square>(static_cast<char>(dest) + (board.GetWhiteToPlay() ? -8 : +8)));
+        }
+        else
+        {
+            gains[0] = BoardEvaluator::GetPieceValue(board.GetPieces()[dest].GetType());
+        }
+
+        // The value of the piece now standing on the square, which is what the next capture wins
+        int onSquareValue = BoardEvaluator::GetPieceValue(board.GetPieces()[init].GetType());
+
+        if (move.IsPromotion())
+        {
+            onSquareValue = BoardEvaluator::GetPieceValue(move.GetPromotionType());
+            gains[0] += onSquareValue - BoardEvaluator::GetPieceValue(Piece::Type::Pawn);
+        }
+
+        bool isWhite = !board.GetWhiteToPlay();
+        size_t numCaptures = 1;
+
+        while (numCaptures < MaxCaptures)
+        {
+            // Looking up the attackers with the pieces which have already captured removed from the occupied squares
+            // also reveals the sliding pieces which were behind them (x-rays)
+            const Bitboard attackers = MoveGenerator::GetAttackers(board, dest, occupied, isWhite) & occupied;
+            if (attackers == 0)
+            {
+                break;
+            }
+
+            // Capture with the least valuable attacker
+            Piece::Type attackerType = Piece::Type::King;
+            Bitboard attacker = 0;
+            for (const Piece::Type type : TypesByValue)
+            {
+                attacker = attackers & board.GetBitboard(type, isWhite);
+                if (attacker != 0)
+                {
+                    attackerType = type;
+                    break;
+                }
+            }
+
+            // The king can only capture if the square is no longer defended
+            if (attackerType == Piece::Type::King &&
+                (MoveGenerator::GetAttackers(board, dest, occupied, !isWhite) & occupied) != 0)
+            {
+                break;
+            }
+
+            gains[numCaptures] = onSquareValue - gains[numCaptures - 1];
+            numCaptures++;
+
+            occupied ^= Helper::SquareBitboard(Helper::BitScanForward(attacker));
+            onSquareValue = BoardEvaluator::GetPieceValue(attackerType);
+            isWhite = !isWhite;
+        }
+
+        // Each player may choose to stop capturing rather than continue the sequence, so work back from the
+        // end of the sequence with each player taking the better of stopping and making the capture
+        while (--numCaptures > 0)
+        {
+            gains[numCaptures - 1] = -std::max(-gains[numCaptures - 1], gains[numCaptures]);
+        }
+
+        return gains[0];
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Definitions.h"
+
+namespace ChessEngine
+{
+    // Static exchange evaluation (https://www.chessprogramming.org/Static_Exchange_Evaluation), resolves the sequence
+    // of captures on a single square without searching, with each player capturing with their least valuable piece
+    // and stopping whenever continuing would lose material. Pieces which attack the square through the pieces which
+    // capture before them (x-rays) join the sequence once those pieces have moved. Pins are ignored.
+    class StaticExchange
+    {
+    public:
+
+        // Get the material won (or lost if negative) by the player to move by making a move and then
+        // resolving the captures on its destination square, using the base piece values
+        static int SEE(const Board& board, const Move move);
+    };
+}
@@ -0,0 +1,100 @@
+#include "pch.h"
+
+#include "TimeManager.h"
+
+namespace ChessEngine
+{
+    namespace
+    {
+        // How much longer than the optimum time the search may take at most
+        constexpr int MaxTimeFactor = 4;
+
+        // The factor the optimum time is scaled by, indexed by the number of iterations the best move has been stable
+        constexpr double StabilityFactors[] = { 1.5, 1.2, 1.0, 0.8, 0.7 };
+
+        // The eval drop (in centipawns) at which the optimum time is scaled by the maximum, and that maximum
+        constexpr int MaxEvalDrop = 100;
+        constexpr double MaxEvalDropFactor = 1.5;
+
+        // Iterations take several times longer than the previous one, so one isn't started when
+        // more than this fraction of the soft limit has been used as it will likely not complete
+        constexpr double StartIterationFraction = 0.5;
+    }
+
+    void TimeManager::Start(const SearchLimits& limits, const bool isWhite)
+    {
+        using std::chrono::milliseconds;
+
+        m_start = Clock::now();
+        m_stableIterations = 0;
+        m_previousEval.reset();
+
+        const std::optional<milliseconds> timeLeft = (isWhite ? limits.whiteTime : limits.blackTime);
+        const milliseconds increment = (isWhite ? limits.whiteIncrement : limits.blackIncrement);
+
+        if (limits.moveTime)
+        {
+            m_isTimed = true;
+            m_optimumTime = m_hardLimit = std::max(*limits.moveTime - MoveOverhead, milliseconds(1));
+        }
+        else if (timeLeft)
+        {
+            // Share the remaining time (less a reserve) between the moves until the next time
+            // control, and expect to get most of the increment back for each of those moves
+            const milliseconds available = std::max(*timeLeft - MoveOverhead, milliseconds(1));
+            const int movesToGo = std::max(limits.movesToGo.value_or(DefaultMovesToGo), 1);
+
+            m_isTimed = true;
+            m_optimumTime = std::min(available / movesToGo + (increment * 3) / 4, available);
+            m_hardLimit = std::min(m_optimumTime * MaxTimeFactor, available);
+        }
+        else
+        {
+            m_isTimed = false;
+            m_optimumTime = m_hardLimit = milliseconds::max();
+        }
+
+        m_softLimit = m_optimumTime;
+    }
+
+    void TimeManager::Update(const bool bestMoveChanged, const int eval)
+    {
+        if (!m_isTimed || m_optimumTime == m_hardLimit)
+        {
+            return;
+        }
+
+        m_stableIterations = (bestMoveChanged ? 0 : m_stableIterations + 1);
+
+        const int numStabilityFactors = static_cast<int>(std::size(StabilityFactors));
+        const double stabilityFactor = StabilityFactors[std::min(m_stableIterations, numStabilityFactors - 1)];
+
+        // Spend longer when the eval drops, we may be about to go wrong and need to find an alternative
+        double evalDropFactor = 1.0;
+        if (m_previousEval && eval < *m_previousEval)
+        {
+            const int evalDrop = std::min(*m_previousEval - eval, MaxEvalDrop);
+            evalDropFactor += (MaxEvalDropFactor - 1.0) * evalDrop / MaxEvalDrop;
+        }
+
+        m_previousEval = eval;
+
+        const auto softLimit = std::chrono::duration_cast<std::chrono::milliseconds>(m_optimumTime * stabilityFactor * evalDropFactor);
+        m_softLimit = std::min(softLimit, m_hardLimit);
+    }
+
+    bool TimeManager::ShouldStartIteration() const
+    {
+        return (!m_isTimed || GetElapsed() < m_softLimit * StartIterationFraction);
+    }
+
+    bool TimeManager::IsTimeUp() const
+    {
+        return (m_isTimed && GetElapsed() >= m_hardLimit);
+    }
+
+    std::chrono::milliseconds TimeManager::GetElapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - m_start);
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+namespace ChessEngine
+{
+    // The limits on a search, these follow the parameters of the UCI 'go' command
+    struct SearchLimits
+    {
+        constexpr static unsigned char MaxDepth = 64;   // The deepest the search will ever go
+
+        std::optional<std::chrono::milliseconds> whiteTime; // The time white has left on the clock (untimed if not set)
+        std::optional<std::chrono::milliseconds> blackTime; // The time black has left on the clock (untimed if not set)
+
+        std::chrono::milliseconds whiteIncrement{ 0 };      // The time added to white's clock after each move
+        std::chrono::milliseconds blackIncrement{ 0 };      // The time added to black's clock after each move
+
+        std::optional<int> movesToGo;                       // The number of moves until the next time control (sudden death if not set)
+
+        std::optional<std::chrono::milliseconds> moveTime;  // Search for exactly this long (overrides the clocks)
+
+        unsigned char maxDepth = MaxDepth;                  // The max depth to search to
+
+        unsigned char numLines = 1;                         // The number of best moves to search for, each with its own line (MultiPV)
+    };
+
+    // Decides how long to spend searching a move. The search is given an optimum time which is adjusted after each
+    // iteration of iterative deepening (searching for longer when the best move is unstable or the eval is dropping)
+    // and a maximum time which is never exceeded.
+    class TimeManager
+    {
+    public:
+
+        using Clock = std::chrono::steady_clock;
+
+        constexpr static std::chrono::milliseconds MoveOverhead{ 50 };  // The time kept in reserve for communication etc.
+
+        constexpr static int DefaultMovesToGo = 30; // The number of moves the remaining time is shared over in sudden death
+
+        // Start timing a search with the given limits for the given player
+        void Start(const SearchLimits& limits, const bool isWhite);
+
+        // Adjust the time allocated after an iteration completes, given whether the best move changed and the eval
+        void Update(const bool bestMoveChanged, const int eval);
+
+        // Get whether there is likely enough time left to complete another iteration
+        bool ShouldStartIteration() const;
+
+        // Get whether the search must stop immediately
+        bool IsTimeUp() const;
+
+        // Get whether the search has a time limit at all
+        bool IsTimed() const { return m_isTimed; }
+
+        // Get the time elapsed since the search started
+        std::chrono::milliseconds GetElapsed() const;
+
+        // Get the time the search is aiming to take (adjusted after each iteration)
+        std::chrono::milliseconds GetSoftLimit() const { return m_softLimit; }
+
+        // Get the time the search will never exceed
+        std::chrono::milliseconds GetHardLimit() const { return m_hardLimit; }
+
+    private:
+
+        Clock::time_point m_start;  // The time that the search started
+
+        bool m_isTimed = false;     // Whether the search has a time limit
+
+        std::chrono::milliseconds m_optimumTime{ 0 };   // The time allocated to the move before any adjustment
+        std::chrono::milliseconds m_softLimit{ 0 };     // The time allocated to the move after adjusting for the state of the search
+        std::chrono::milliseconds m_hardLimit{ 0 };     // The time after which the search must stop
+
+        int m_stableIterations = 0;     // The number of consecutive iterations the best move has not changed
+
+        std::optional<int> m_previousEval;  // The eval of the previous iteration
+    };
+}
@@ -0,0 +1,121 @@
+#include "pch.h"
+
+#include "TranspositionTable.h"
+
+namespace ChessEngine
+{
+    namespace
+    {
+        // The weighting of an entry's age relative to its depth when choosing an entry to replace,
+        // an entry from the previous search is worth roughly as much as one searched 8 ply shallower
+        constexpr int AgeReplacementWeight = 8;
+    }
+
+    TranspositionTableEntry::TranspositionTableEntry(
+        const uint64_t hash,
+        const unsigned char depth,
+        const Bound bound,
+        const int eval,
+        const Move move,
+        const uint8_t age) :
+        m_hash(hash),
+        m_eval(eval),
+        m_move(move),
+        m_depth(depth),
+        m_boundAndAge(static_cast<uint8_t>(static_cast<uint8_t>(bound) | (age << AgeOffset)))
+    {
+    }
+
+    bool TranspositionTableEntry::operator==(const TranspositionTableEntry& other) const
+    {
+        return (
+            (m_hash == other.m_hash) &&
+            (m_eval == other.m_eval) &&
+            (m_move == other.m_move) &&
+            (m_depth == other.m_depth) &&
+            (m_boundAndAge == other.m_boundAndAge));
+    }
+
+    TranspositionTable::TranspositionTable(const size_t sizeInMB)
+    {
+        Resize(sizeInMB);
+    }
+
+    void TranspositionTable::Resize(const size_t sizeInMB)
+    {
+        // Use the largest power of 2 number of buckets that fits in the requested size
+        // so that a hash can be mapped to a bucket with a mask rather than a modulo.
+        const size_t maxNumBuckets = std::max<size_t>((sizeInMB * 1024 * 1024) / sizeof(Bucket), 1);
+
+        size_t numBuckets = 1;
+        while ((numBuckets * 2) <= maxNumBuckets)
+        {
+            numBuckets *= 2;
+        }
+
+        m_buckets = std::vector<Bucket>(numBuckets);
+        m_mask = numBuckets - 1;
+        m_age = 0;
+    }
+
+    void TranspositionTable::Clear()
+    {
+        std::fill(m_buckets.begin(), m_buckets.end(), Bucket());
+        m_age = 0;
+    }
+
+    std::optional<TranspositionTableEntry> TranspositionTable::Probe(const uint64_t hash) const
+    {
+        for (const TranspositionTableEntry& entry : GetBucket(hash).entries)
+        {
+            if (entry.IsInitialized() && entry.GetHash() == hash)
+            {
+                return entry;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    void TranspositionTable::Store(
+        const uint64_t hash,
+        const unsigned char depth,
+        const TranspositionTableEntry::Bound bound,
+        const int eval,
+        const Move move)
+    {
+        Bucket& bucket = GetBucket(hash);
+
+        // Lambda for getting how valuable an entry is to keep, deeper and more recent entries are more valuable
+        auto getValue = [this](const TranspositionTableEntry& entry) -> int
+        {
+            if (!entry.IsInitialized())
+            {
+                return std::numeric_limits<int>::min();
+            }
+
+            const int relativeAge = (m_age - entry.GetAge()) & MaxAge;
+            return static_cast<int>(entry.GetDepth()) - (relativeAge * AgeReplacementWeight);
+        };
+
+        TranspositionTableEntry* replace = &bucket.entries[0];
+
+        for (TranspositionTableEntry& entry : bucket.entries)
+        {
+            // Always replace an existing entry for the same position, but keep the
+            // best move of the existing entry if we didn't find one this time
+            if (entry.IsInitialized() && entry.GetHash() == hash)
+            {
+                entry = TranspositionTableEntry(hash, depth, bound, eval, (move != Move() ? move : entry.GetMove()), m_age);
+                return;
+            }
+
+            if (getValue(entry) < getValue(*replace))
+            {
+                replace = &entry;
+            }
+        }
+
+        *replace = TranspositionTableEntry(hash, depth, bound, eval, move, m_age);
+    }
+}
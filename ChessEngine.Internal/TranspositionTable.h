@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Definitions.h"
+#include "Move.h"
+
+namespace ChessEngine
+{
+    class TranspositionTableEntry
+    {
+    public:
+
+        // The type of bound that the evaluation stored in an entry represents
+        enum class Bound : uint8_t
+        {
+            None  = 0b00,   // The entry is not initialized
+            Exact = 0b01,   // The evaluation is exact (alpha < eval < beta)
+            Lower = 0b10,   // The evaluation is a lower bound (eval >= beta, a fail high)
+            Upper = 0b11,   // The evaluation is an upper bound (eval <= alpha, a fail low)
+        };
+
+        // Create a new (uninitialized) entry
+        TranspositionTableEntry() = default;
+
+        // Create a new entry with the given properties (hash, depth, bound, eval, best move, age)
+        TranspositionTableEntry(
+            const uint64_t hash,
+            const unsigned char depth,
+            const Bound bound,
+            const int eval,
+            const Move move,
+            const uint8_t age);
+
+        // Compare one entry to another
+        bool operator==(const TranspositionTableEntry& other) const;
+        bool operator!=(const TranspositionTableEntry& other) const { return !(*this == other); }
+
+        // Get the hash of the position this entry is for
+        uint64_t GetHash() const { return m_hash; }
+
+        // Get whether the entry has been initialized
+        bool IsInitialized() const { return GetBound() != Bound::None; }
+
+        // Get the depth that the position was searched to
+        unsigned char GetDepth() const { return m_depth; }
+
+        // Get the type of bound that the evaluation represents
+        Bound GetBound() const { return Bound(m_boundAndAge & BoundMask); }
+
+        // Get the evaluation of the position (from the perspective of the player to move)
+        int GetEval() const { return m_eval; }
+
+        // Get the best move found for the position (may be Move() if no move was found)
+        Move GetMove() const { return m_move; }
+
+        // Get the age (search number) that the entry was stored in
+        uint8_t GetAge() const { return (m_boundAndAge >> AgeOffset); }
+
+    private:
+
+        const static uint8_t BoundMask = 0b00'00'00'11;  // The mask for extracting the bound
+        const static uint8_t AgeOffset = 2;              // The offset of the 6 bits for the age
+
+        uint64_t m_hash = 0;            // The hash of the position this entry is for
+        int m_eval = 0;                 // The evaluation of the position
+        Move m_move;                    // The best move found for the position
+        unsigned char m_depth = 0;      // The depth that the position was searched to
+        uint8_t m_boundAndAge = 0;      // The bound (lower 2 bits) and age (upper 6 bits) of the entry
+    };
+
+    class TranspositionTable
+    {
+    public:
+
+        constexpr static size_t DefaultSizeInMB = 64;   // The default size of the table in MB
+
+        constexpr static size_t EntriesPerBucket = 4;   // The number of entries in each bucket (one cache line)
+
+        constexpr static uint8_t MaxAge = 0b00'11'11'11; // The max age before wrapping (ages are stored in 6 bits)
+
+        // Create a new transposition table with the given size (in MB)
+        TranspositionTable(const size_t sizeInMB = DefaultSizeInMB);
+
+        // Resize the table to the given size (in MB), this clears the table
+        void Resize(const size_t sizeInMB);
+
+        // Clear all the entries in the table
+        void Clear();
+
+        // Increment the age of the table, this should be called at the start of each new search
+        void IncrementAge() { m_age = (m_age + 1) & MaxAge; }
+
+        // Get the entry for a given hash (if there is one)
+        std::optional<TranspositionTableEntry> Probe(const uint64_t hash) const;
+
+        // Store an entry for a given hash, replacing the least valuable entry in the bucket if necessary
+        void Store(
+            const uint64_t hash,
+            const unsigned char depth,
+            const TranspositionTableEntry::Bound bound,
+            const int eval,
+            const Move move);
+
+        // Get the total number of entries the table can hold
+        size_t GetNumEntries() const { return m_buckets.size() * EntriesPerBucket; }
+
+        // Get the age of the table
+        uint8_t GetAge() const { return m_age; }
+
+    private:
+
+        // A bucket of entries which shares a single cache line
+        struct alignas(64) Bucket
+        {
+            std::array<TranspositionTableEntry, EntriesPerBucket> entries;
+        };
+
+        static_assert(sizeof(TranspositionTableEntry) == 16, "Transposition table entries should be 16 bytes.");
+        static_assert(sizeof(Bucket) == 64, "Transposition table buckets should be a single cache line.");
+
+        // Get the bucket for a given hash
+        Bucket& GetBucket(const uint64_t hash) { return m_buckets[hash & m_mask]; }
+        const Bucket& GetBucket(const uint64_t hash) const { return m_buckets[hash & m_mask]; }
+
+        std::vector<Bucket> m_buckets;  // The buckets of entries (the number of buckets is a power of 2)
+
+        uint64_t m_mask = 0;    // The mask for mapping a hash to a bucket index
+
+        uint8_t m_age = 0;      // The current age of the table
+    };
+}
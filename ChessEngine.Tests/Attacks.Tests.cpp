@@ -0,0 +1,114 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "Attacks.h"
+#include "Helper.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ChessEngineTests
+{
+    using namespace ChessEngine;
+
+    TEST_CLASS(AttacksTests)
+    {
+    public:
+
+        // Test the attacks of the non-sliding pieces for a few squares
+        TEST_METHOD(TestStepAttacks)
+        {
+            const Square a1 = Helper::SquareFromString("a1");
+            const Square e4 = Helper::SquareFromString("e4");
+            const Square h8 = Helper::SquareFromString("h8");
+
+            Assert::IsTrue(Attacks::GetPawnAttacks(e4, true) == (Helper::SquareBitboard(Helper::SquareFromString("d5")) | Helper::SquareBitboard(Helper::SquareFromString("f5"))));
+            Assert::IsTrue(Attacks::GetPawnAttacks(e4, false) == (Helper::SquareBitboard(Helper::SquareFromString("d3")) | Helper::SquareBitboard(Helper::SquareFromString("f3"))));
+            Assert::IsTrue(Attacks::GetPawnAttacks(a1, false) == 0);
+
+            Assert::AreEqual(2, Helper::PopCount(Attacks::GetKnightAttacks(a1)));
+            Assert::AreEqual(8, Helper::PopCount(Attacks::GetKnightAttacks(e4)));
+            Assert::AreEqual(2, Helper::PopCount(Attacks::GetKnightAttacks(h8)));
+
+            Assert::AreEqual(3, Helper::PopCount(Attacks::GetKingAttacks(a1)));
+            Assert::AreEqual(8, Helper::PopCount(Attacks::GetKingAttacks(e4)));
+            Assert::AreEqual(3, Helper::PopCount(Attacks::GetKingAttacks(h8)));
+        }
+
+        // Test the attacks of the sliding pieces on an empty board and when blocked
+        TEST_METHOD(TestSlidingAttacks)
+        {
+            const Square d4 = Helper::SquareFromString("d4");
+
+            Assert::AreEqual(13, Helper::PopCount(Attacks::GetBishopAttacks(d4, 0)));
+            Assert::AreEqual(14, Helper::PopCount(Attacks::GetRookAttacks(d4, 0)));
+            Assert::AreEqual(27, Helper::PopCount(Attacks::GetQueenAttacks(d4, 0)));
+
+            // Blockers on d6 and f6, the blocking squares themselves are attacked but nothing beyond them
+            const Bitboard occupied = Helper::SquareBitboard(Helper::SquareFromString("d6")) | Helper::SquareBitboard(Helper::SquareFromString("f6"));
+
+            const Bitboard rookAttacks = Attacks::GetRookAttacks(d4, occupied);
+            Assert::IsTrue((rookAttacks & Helper::SquareBitboard(Helper::SquareFromString("d6"))) != 0);
+            Assert::IsTrue((rookAttacks & Helper::SquareBitboard(Helper::SquareFromString("d7"))) == 0);
+            Assert::AreEqual(12, Helper::PopCount(rookAttacks));
+
+            const Bitboard bishopAttacks = Attacks::GetBishopAttacks(d4, occupied);
+            Assert::IsTrue((bishopAttacks & Helper::SquareBitboard(Helper::SquareFromString("f6"))) != 0);
+            Assert::IsTrue((bishopAttacks & Helper::SquareBitboard(Helper::SquareFromString("g7"))) == 0);
+            Assert::AreEqual(11, Helper::PopCount(bishopAttacks));
+        }
+
+        // Test that the magic bitboard (and PEXT if supported) lookups agree with walking the rays for many random occupancies
+        TEST_METHOD(TestSlidingAttacksMatchSlowAttacks)
+        {
+            const Attacks::Backend defaultBackend = Attacks::GetBackend();
+
+            std::vector<Attacks::Backend> backends = { Attacks::Backend::Magic };
+            if (Attacks::IsPextSupported())
+            {
+                backends.push_back(Attacks::Backend::Pext);
+            }
+
+            for (const Attacks::Backend backend : backends)
+            {
+                Attacks::SetBackend(backend);
+
+                uint64_t state = 0xC0FF'EE00'C0FF'EE00;
+
+                for (Square square = 0; Helper::IsValidSquare(square); square++)
+                {
+                    for (int i = 0; i < 256; i++)
+                    {
+                        // AND together a few random numbers to get sparser (more realistic) occupancies
+                        const Bitboard occupied = Helper::SplitMix64(state) & Helper::SplitMix64(state) & Helper::SplitMix64(state);
+
+                        Assert::IsTrue(Attacks::GetBishopAttacks(square, occupied) == Attacks::GetBishopAttacksSlow(square, occupied));
+                        Assert::IsTrue(Attacks::GetRookAttacks(square, occupied) == Attacks::GetRookAttacksSlow(square, occupied));
+                    }
+                }
+            }
+
+            Attacks::SetBackend(defaultBackend);
+        }
+
+        // Test that the PEXT backend can only be selected when the CPU supports it
+        TEST_METHOD(TestSetBackend)
+        {
+            const Attacks::Backend defaultBackend = Attacks::GetBackend();
+
+            Attacks::SetBackend(Attacks::Backend::Magic);
+            Assert::IsTrue(Attacks::GetBackend() == Attacks::Backend::Magic);
+
+            if (Attacks::IsPextSupported())
+            {
+                Attacks::SetBackend(Attacks::Backend::Pext);
+                Assert::IsTrue(Attacks::GetBackend() == Attacks::Backend::Pext);
+            }
+            else
+            {
+                Assert::ExpectException<std::runtime_error>([]() { Attacks::SetBackend(Attacks::Backend::Pext); });
+            }
+
+            Attacks::SetBackend(defaultBackend);
+        }
+    };
+}
@@ -2,6 +2,7 @@
 #include "CppUnitTest.h"
 
 #include "Board.h"
+#include "Helper.h"
 #include "Move.h"
 #include "MoveInverse.h"
 #include "Piece.h"
@@ -36,6 +37,60 @@ namespace ChessEngineTests
             }
         }
 
+        // Test that the bitboards of a board are consistent with its piece array
+        void TestBitboards(const Board& board)
+        {
+            Bitboard whiteBitboard = 0;
+            Bitboard blackBitboard = 0;
+
+            for (Square square = 0; Helper::IsValidSquare(square); square++)
+            {
+                const Piece piece = board.GetPieces()[square];
+                const Bitboard squareBitboard = Helper::SquareBitboard(square);
+
+                std::wstring squareWStr = Helper::StringToWString(Helper::StringFromSquare(square));
+
+                if (piece.IsEmpty())
+                {
+                    Assert::IsTrue((board.GetOccupiedBitboard() & squareBitboard) == 0, squareWStr.c_str());
+                    continue;
+                }
+
+                Assert::IsTrue((board.GetBitboard(piece) & squareBitboard) != 0, squareWStr.c_str());
+                Assert::IsTrue((board.GetBitboard(piece.GetType()) & squareBitboard) != 0, squareWStr.c_str());
+
+                (piece.IsWhite() ? whiteBitboard : blackBitboard) |= squareBitboard;
+            }
+
+            Assert::IsTrue(whiteBitboard == board.GetColourBitboard(true));
+            Assert::IsTrue(blackBitboard == board.GetColourBitboard(false));
+
+            // Each occupied square should be in exactly one of the piece bitboards
+            int numPieces = 0;
+            for (const auto& type : Piece::AllTypes)
+            {
+                if (type != Piece::Type::Empty)
+                {
+                    numPieces += Helper::PopCount(board.GetBitboard(type));
+                }
+            }
+            Assert::AreEqual(Helper::PopCount(board.GetOccupiedBitboard()), numPieces);
+        }
+
+        // Test that the bitboards are set correctly from a FEN string
+        TEST_METHOD(TestFENBitboards)
+        {
+            for (const std::string& FEN : FENVector)
+            {
+                TestBitboards(Board(FEN));
+            }
+
+            const Board board;
+            Assert::IsTrue(board.GetOccupiedBitboard() == 0xFFFF'0000'0000'FFFF);
+            Assert::IsTrue(board.GetBitboard(Piece::wp) == 0x0000'0000'0000'FF00);
+            Assert::IsTrue(board.GetBitboard(Piece::bk) == Helper::SquareBitboard(Helper::SquareFromString("e8")));
+        }
+
         // Test making and unmaking a move for white and a move for black
         void TestMoveUnMove(
             const std::string& startingFEN,
@@ -47,25 +102,30 @@ namespace ChessEngineTests
         {
             Board board(startingFEN);
 
-            unsigned int initialHash = board.GetHash();
+            uint64_t initialHash = board.GetHash();
 
             MoveInverse whiteMoveInverse(board, whiteMove);
 
             board.MakeMove(whiteMove);
             Assert::AreEqual(whiteMoveFEN, board.GetFEN());
+            Assert::AreEqual(Board(whiteMoveFEN).GetHash(), board.GetHash());
+            TestBitboards(board);
 
             MoveInverse blackMoveInverse(board, blackMove);
 
             board.MakeMove(blackMove);
             Assert::AreEqual(blackMoveFEN, board.GetFEN());
+            Assert::AreEqual(Board(blackMoveFEN).GetHash(), board.GetHash());
+            TestBitboards(board);
 
             board.UndoMove(blackMoveInverse);
             Assert::AreEqual(whiteMoveFEN, board.GetFEN());
 
             board.UndoMove(whiteMoveInverse);
             Assert::AreEqual(startingFEN, board.GetFEN());
+            TestBitboards(board);
 
-            unsigned int finalHash = board.GetHash();
+            uint64_t finalHash = board.GetHash();
             Assert::AreEqual(initialHash, finalHash);
         }
 
@@ -78,17 +138,19 @@ namespace ChessEngineTests
         {
             Board board(startingFEN);
 
-            unsigned int initialHash = board.GetHash();
+            uint64_t initialHash = board.GetHash();
 
             MoveInverse moveInverse(board, move);
 
             board.MakeMove(move);
             Assert::AreEqual(endingFEN, board.GetFEN());
+            TestBitboards(board);
 
             board.UndoMove(moveInverse);
             Assert::AreEqual(startingFEN, board.GetFEN());
+            TestBitboards(board);
 
-            unsigned int finalHash = board.GetHash();
+            uint64_t finalHash = board.GetHash();
             Assert::AreEqual(initialHash, finalHash);
         }
 
@@ -190,6 +252,20 @@ namespace ChessEngineTests
             TestMoveUnMove(startingFEN, whiteMoveFEN, blackMoveFEN, whiteMove, blackMove);
         }
 
+        // Test that capturing a rook on its starting square removes the right to castle with it
+        TEST_METHOD(TestMoveUnMoveRookCapture)
+        {
+            // Bishops trading off the rooks in the corners
+            const std::string startingFEN = "r3k2r/1b6/8/8/8/8/6B1/R3K2R w KQkq - 0 1";
+            const std::string whiteMoveFEN = "B3k2r/1b6/8/8/8/8/8/R3K2R b KQk - 0 1";  // After 1. Bxa8
+            const std::string blackMoveFEN = "B3k2r/8/8/8/8/8/8/R3K2b w Qk - 0 2";     // After 1. --- Bxh1
+
+            Move whiteMove("g2", "a8", true);   // 1. Bxa8
+            Move blackMove("b7", "h1", true);   // 1. --- Bxh1
+
+            TestMoveUnMove(startingFEN, whiteMoveFEN, blackMoveFEN, whiteMove, blackMove);
+        }
+
         // Test that double pawn push moves update the state of the board correctly
         TEST_METHOD(TestMoveUnMoveDoublePawnPush)
         {
@@ -227,5 +303,100 @@ namespace ChessEngineTests
                 TestMoveUnMove(startingFEN, endingFEN, move);
             }
         }
+
+        // Test that a null move passes the turn (clearing any en passant square) and can be undone
+        TEST_METHOD(TestMakeUndoNullMove)
+        {
+            const std::string startingFEN = "rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 3";
+            const std::string endingFEN = "rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR w KQkq - 0 4";
+
+            Board board(startingFEN);
+
+            MoveInverse moveInverse(board, Move());
+
+            board.MakeNullMove();
+            Assert::AreEqual(endingFEN, board.GetFEN());
+            Assert::AreEqual(Board(endingFEN).GetHash(), board.GetHash());
+
+            board.UndoNullMove(moveInverse);
+            Assert::AreEqual(startingFEN, board.GetFEN());
+            Assert::AreEqual(Board(startingFEN).GetHash(), board.GetHash());
+            TestBitboards(board);
+        }
+
+        TEST_METHOD(TestRepetition)
+        {
+            Board board;
+            Assert::IsFalse(board.IsRepetition());
+
+            // Shuffle the knights out and back, repeating the starting position
+            for (int i = 0; i < 2; i++)
+            {
+                board.MakeMove(Move("g1", "f3"));
+                board.MakeMove(Move("g8", "f6"));
+                Assert::AreEqual(i == 1, board.IsRepetition());
+                board.MakeMove(Move("f3", "g1"));
+                Assert::AreEqual(i == 1, board.IsRepetition());
+                board.MakeMove(Move("f6", "g8"));
+                Assert::IsTrue(board.IsRepetition());
+                Assert::AreEqual(i == 1, board.IsThreefoldRepetition());
+            }
+
+            // Undoing a move pops its position from the history
+            MoveInverse moveInverse(board, Move("b1", "c3"));
+            board.MakeMove(Move("b1", "c3"));
+            Assert::IsFalse(board.IsRepetition());
+            board.UndoMove(moveInverse);
+            Assert::IsTrue(board.IsThreefoldRepetition());
+
+            // Only the positions since the last irreversible move are checked
+            board.MakeMove(Move("e2", "e3"));
+            Assert::IsFalse(board.IsRepetition());
+            board.MakeMove(Move("g8", "f6"));
+            board.MakeMove(Move("g1", "f3"));
+            board.MakeMove(Move("f6", "g8"));
+            board.MakeMove(Move("f3", "g1"));
+            Assert::IsTrue(board.IsRepetition());
+            Assert::IsFalse(board.IsThreefoldRepetition());
+        }
+
+        TEST_METHOD(TestRepetitionAfterNullMove)
+        {
+            Board board("4k3/8/8/8/8/8/8/4K3 w - - 0 1");
+
+            // White passes then black triangulates, reaching the starting position again (only by passing the turn)
+            board.MakeNullMove();
+            board.MakeMove(Move("e8", "e7"));
+            board.MakeMove(Move("e1", "e2"));
+            board.MakeMove(Move("e7", "d8"));
+            board.MakeMove(Move("e2", "e1"));
+            board.MakeMove(Move("d8", "e8"));
+
+            Assert::AreEqual(Board("4k3/8/8/8/8/8/8/4K3 w - - 0 1").GetHash(), board.GetHash());
+            Assert::IsFalse(board.IsRepetition());
+        }
+
+        TEST_METHOD(TestFiftyMoveDraw)
+        {
+            Assert::IsFalse(Board("4k3/8/8/8/8/8/8/R3K3 w - - 99 80").IsFiftyMoveDraw());
+            Assert::IsTrue(Board("4k3/8/8/8/8/8/8/R3K3 w - - 100 80").IsFiftyMoveDraw());
+
+            Board board("4k3/8/8/8/8/8/8/R3K3 w - - 99 80");
+            board.MakeMove(Move("a1", "a2"));
+            Assert::IsTrue(board.IsFiftyMoveDraw());
+        }
+
+        TEST_METHOD(TestInsufficientMaterial)
+        {
+            Assert::IsTrue(Board("4k3/8/8/8/8/8/8/4K3 w - - 0 1").IsInsufficientMaterial());
+            Assert::IsTrue(Board("4k3/8/8/8/8/8/8/2N1K3 w - - 0 1").IsInsufficientMaterial());
+            Assert::IsTrue(Board("4k3/8/8/8/8/8/8/2B1K3 w - - 0 1").IsInsufficientMaterial());
+            Assert::IsTrue(Board("2b1k3/8/8/8/8/8/8/3BK3 w - - 0 1").IsInsufficientMaterial());
+            Assert::IsFalse(Board("3bk3/8/8/8/8/8/8/3BK3 w - - 0 1").IsInsufficientMaterial());
+            Assert::IsFalse(Board("4k3/8/8/8/8/8/8/1NN1K3 w - - 0 1").IsInsufficientMaterial());
+            Assert::IsFalse(Board("4k3/8/8/8/8/8/8/1B2KN2 w - - 0 1").IsInsufficientMaterial());
+            Assert::IsFalse(Board("4k3/8/8/8/8/8/4P3/4K3 w - - 0 1").IsInsufficientMaterial());
+            Assert::IsFalse(Board("4k3/8/8/8/8/8/8/R3K3 w - - 0 1").IsInsufficientMaterial());
+        }
     };
 }
\ No newline at end of file
@@ -86,5 +86,34 @@ namespace ChessEngineTests
             Assert::AreEqual(std::string("d5"), StringFromSquare(Square(35)));
             Assert::AreEqual(std::string("e5"), StringFromSquare(Square(36)));
         }
+
+        TEST_METHOD(TestBitboardHelpers)
+        {
+            // Test that the bitboard helper functions work
+            Assert::IsTrue(SquareBitboard(0) == 0x1ULL);
+            Assert::IsTrue(SquareBitboard(63) == 0x8000'0000'0000'0000ULL);
+
+            Assert::AreEqual(0, PopCount(0));
+            Assert::AreEqual(1, PopCount(SquareBitboard(63)));
+            Assert::AreEqual(64, PopCount(~0ULL));
+
+            Assert::AreEqual(Square(0), BitScanForward(0x1ULL));
+            Assert::AreEqual(Square(63), BitScanForward(SquareBitboard(63)));
+
+            Bitboard bitboard = SquareBitboard(3) | SquareBitboard(27) | SquareBitboard(60);
+            Assert::AreEqual(Square(3), PopLowestSquare(bitboard));
+            Assert::AreEqual(Square(27), PopLowestSquare(bitboard));
+            Assert::AreEqual(Square(60), PopLowestSquare(bitboard));
+            Assert::IsTrue(bitboard == 0);
+        }
+
+        TEST_METHOD(TestSplitMix64)
+        {
+            // Test that the SplitMix64 helper function produces the reference values for splitmix64
+            uint64_t state = 0;
+            Assert::IsTrue(SplitMix64(state) == 0xE220'A839'7B1D'CDAF);
+            Assert::IsTrue(SplitMix64(state) == 0x6E78'9E6A'A1B9'65F4);
+            Assert::IsTrue(SplitMix64(state) == 0x06C4'5D18'8009'454F);
+        }
     };
 }
\ No newline at end of file
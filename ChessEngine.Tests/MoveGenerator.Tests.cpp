@@ -6,6 +6,8 @@
 #include "Helper.h"
 #include "Move.h"
 #include "MoveGenerator.h"
+#include "MoveInverse.h"
+#include "MoveList.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -211,8 +213,8 @@ namespace ChessEngineTests
             {
                 return (move1.GetValue() > move2.GetValue());
             };
-            expMoves.sort(comparator);
-            genMoves.sort(comparator);
+            std::sort(expMoves.begin(), expMoves.end(), comparator);
+            std::sort(genMoves.begin(), genMoves.end(), comparator);
 
             // Assert contents are equal
             std::wostringstream listSS;
@@ -365,8 +367,8 @@ namespace ChessEngineTests
                     // Queen moves
                     {"e3", "b3", true}, {"e3", "c1"}, {"e3", "c3"}, {"e3", "d2"}, {"e3", "d3"}, {"e3", "e1"}, {"e3", "e2"}, 
                     {"e3", "f2"}, {"e3", "f3"}, {"e3", "f4"}, {"e3" ,"g1"}, {"e3", "g3"}, {"e3", "h3"},
-                    // King moves
-                    {"b1", "a1"}, {"b1", "a2"}, {"b1", "c1"}, {"b1", "c2"}
+                    // King moves (not a2 or c2 which are attacked by the pawn on b3)
+                    {"b1", "a1"}, {"b1", "c1"}
                 };
                 TestMoveGenerationForFEN(whiteFEN, whiteExpectedMoves);
 
@@ -394,5 +396,135 @@ namespace ChessEngineTests
                 TestMoveGenerationForFEN(blackFEN, blackExpectedMoves);
             }
         }
+
+        TEST_METHOD(TestLegalMoveGeneration)
+        {
+            // Test that a pinned piece can only move along the line of the pin
+            {
+                const std::string bishopFEN = "4k3/4r3/8/8/8/8/4B3/4K3 w - - 0 1";
+                const MoveList bishopExpectedMoves = {
+                    {"e1", "d1"}, {"e1", "d2"}, {"e1", "f1"}, {"e1", "f2"}
+                };
+                TestMoveGenerationForFEN(bishopFEN, bishopExpectedMoves);
+
+                const std::string rookFEN = "4k3/4r3/8/8/8/8/4R3/4K3 w - - 0 1";
+                const MoveList rookExpectedMoves = {
+                    {"e2", "e3"}, {"e2", "e4"}, {"e2", "e5"}, {"e2", "e6"}, {"e2", "e7", true},
+                    {"e1", "d1"}, {"e1", "d2"}, {"e1", "f1"}, {"e1", "f2"}
+                };
+                TestMoveGenerationForFEN(rookFEN, rookExpectedMoves);
+            }
+
+            // Test that when in check only moves which capture the checker, block the check or move the king are generated
+            // (the king can't step back along the line of the check)
+            {
+                const std::string FEN = "4k3/8/8/8/8/8/1B6/r3K3 w - - 0 1";
+                const MoveList expectedMoves = {
+                    {"b2", "a1", true}, {"b2", "c1"},
+                    {"e1", "d2"}, {"e1", "e2"}, {"e1", "f2"}
+                };
+                TestMoveGenerationForFEN(FEN, expectedMoves);
+            }
+
+            // Test that when in double check only king moves are generated
+            {
+                const std::string FEN = "4k3/8/8/8/7b/8/8/r3K2N w - - 0 1";
+                const MoveList expectedMoves = {
+                    {"e1", "d2"}, {"e1", "e2"}
+                };
+                TestMoveGenerationForFEN(FEN, expectedMoves);
+            }
+
+            // Test that an en passant capture is not generated when it exposes the king along the rank
+            {
+                const Board board("8/8/8/KPp4r/8/8/8/4k3 w - c6 0 1");
+                TestListContainsMove(MoveGenerator::GenerateMoves(board), Move("b5", "c6", Move::Special::EnPassantCapture), false);
+            }
+
+            // Test that an en passant capture is generated when it captures the pawn giving check
+            {
+                const Board board("8/8/8/2k5/3Pp3/8/8/4K3 b - d3 0 1");
+                TestListContainsMove(MoveGenerator::GenerateMoves(board), Move("e4", "d3", Move::Special::EnPassantCapture), true);
+            }
+        }
+
+        TEST_METHOD(TestCapturesAndPromotionsGeneration)
+        {
+            // Test that exactly the captures and promotions of the full list of legal moves are generated
+            // (positions with castling, en passant, pins and promotions, see the perft tests)
+            const std::vector<std::string> FENs = {
+                "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+                "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+                "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+                "8/8/8/2k5/3Pp3/8/8/4K3 b - d3 0 1"
+            };
+
+            for (const std::string& FEN : FENs)
+            {
+                const Board board(FEN);
+
+                MoveList expectedMoves;
+                for (const Move& move : MoveGenerator::GenerateMoves(board))
+                {
+                    if (move.IsCapture() || move.IsPromotion())
+                    {
+                        expectedMoves.push_back(move);
+                    }
+                }
+
+                const MoveList genMoves = MoveGenerator::GenerateMoves(board, MoveGenerator::Mode::CapturesAndPromotions);
+
+                Assert::AreEqual(expectedMoves.size(), genMoves.size(), Helper::StringToWString(FEN).c_str());
+                for (const Move& move : expectedMoves)
+                {
+                    TestListContainsMove(genMoves, move, true);
+                }
+            }
+
+            // Test that a quiet promotion is generated, but a quiet pawn push and castling are not
+            {
+                const Board board("4k3/1P6/8/8/8/8/4P3/4K2R w K - 0 1");
+                const MoveList genMoves = MoveGenerator::GenerateMoves(board, MoveGenerator::Mode::CapturesAndPromotions);
+
+                TestListContainsMove(genMoves, Move("b7", "b8", false, true, Piece::Type::Queen), true);
+                TestListContainsMove(genMoves, Move("e2", "e3"), false);
+                TestListContainsMove(genMoves, Move("e1", "g1", Move::Special::KingsideCastles), false);
+                Assert::AreEqual(size_t(4), genMoves.size());
+            }
+        }
+
+        TEST_METHOD(TestGivesCheck)
+        {
+            // Test that whether each legal move gives check matches making the move and testing for check (positions with
+            // direct and discovered checks, checks by castling, en passant and promotion, see also the perft tests)
+            const std::vector<std::string> FENs = {
+                "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+                "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+                "5k2/8/8/8/8/8/8/4K2R w K - 0 1",
+                "3k4/8/8/8/8/8/8/R3K3 w Q - 0 1",
+                "4k3/8/8/8/4N3/8/4B3/4R1K1 w - - 0 1",
+                "8/8/8/k1pP3R/8/8/8/4K3 w - c6 0 1",
+                "1n1k4/P1P5/8/8/8/8/8/4K3 w - - 0 1"
+            };
+
+            for (const std::string& FEN : FENs)
+            {
+                Board board(FEN);
+
+                for (const Move& move : MoveGenerator::GenerateMoves(board))
+                {
+                    const bool givesCheck = MoveGenerator::GivesCheck(board, move);
+
+                    MoveInverse moveInverse(board, move);
+                    board.MakeMove(move);
+
+                    Assert::AreEqual(MoveGenerator::IsInCheck(board), givesCheck, Helper::StringToWString(FEN + " " + move.GetString()).c_str());
+
+                    board.UndoMove(moveInverse);
+                }
+            }
+        }
     };
 }
@@ -0,0 +1,127 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "Board.h"
+#include "Move.h"
+#include "MoveGenerator.h"
+#include "MoveList.h"
+#include "MovePicker.h"
+#include "SearchHistory.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ChessEngineTests
+{
+    using namespace ChessEngine;
+
+    TEST_CLASS(MovePickerTests)
+    {
+    public:
+
+        // Test that the hash move is picked first, followed by the captures in MVV-LVA order, followed by the quiet moves
+        TEST_METHOD(TestPickOrder)
+        {
+            const Board board("4k3/8/3q1r2/4P3/2N5/8/8/4K3 w - - 0 1");
+
+            MoveList moveList = MoveGenerator::GenerateMoves(board);
+            const size_t numMoves = moveList.size();
+
+            const Move hashMove("c4", "b2");
+            MovePicker movePicker(moveList, board, hashMove);
+
+            Assert::IsTrue(movePicker.PickNext() == hashMove);
+            Assert::IsTrue(movePicker.PickNext() == Move("e5", "d6", true));
+            Assert::IsTrue(movePicker.PickNext() == Move("c4", "d6", true));
+            Assert::IsTrue(movePicker.PickNext() == Move("e5", "f6", true));
+
+            size_t numPicked = 4;
+            while (movePicker.HasNext())
+            {
+                Assert::IsFalse(movePicker.PickNext().IsCapture());
+                numPicked++;
+            }
+
+            Assert::AreEqual(numMoves, numPicked);
+        }
+
+        // Test that every move is picked exactly once
+        TEST_METHOD(TestPicksEveryMove)
+        {
+            const Board board("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+            const MoveList expectedMoves = MoveGenerator::GenerateMoves(board);
+
+            MoveList moveList = expectedMoves;
+            MovePicker movePicker(moveList, board, Move());
+
+            MoveList pickedMoves;
+            while (movePicker.HasNext())
+            {
+                pickedMoves.push_back(movePicker.PickNext());
+            }
+
+            Assert::AreEqual(expectedMoves.size(), pickedMoves.size());
+            for (const Move& move : expectedMoves)
+            {
+                Assert::AreEqual(1, static_cast<int>(std::count(pickedMoves.begin(), pickedMoves.end(), move)));
+            }
+        }
+
+        // Test the scores of promotions relative to captures and quiet moves
+        TEST_METHOD(TestScorePromotions)
+        {
+            const Board board("1r2k3/P7/8/8/8/8/8/4K3 w - - 0 1");
+
+            const int queenPromotion = MovePicker::ScoreMove(board, Move("a7", "a8", false, true, Piece::Type::Queen), Move());
+            const int queenPromotionCapture = MovePicker::ScoreMove(board, Move("a7", "b8", true, true, Piece::Type::Queen), Move());
+            const int knightPromotion = MovePicker::ScoreMove(board, Move("a7", "a8", false, true, Piece::Type::Knight), Move());
+            const int quietMove = MovePicker::ScoreMove(board, Move("e1", "e2"), Move());
+
+            Assert::IsTrue(queenPromotionCapture > queenPromotion);
+            Assert::IsTrue(queenPromotion >= MovePicker::CaptureScore);
+            Assert::IsTrue(knightPromotion < quietMove);
+        }
+
+        // Test that quiet moves are picked after the captures, with the killer moves first and then by history
+        TEST_METHOD(TestPickQuietOrder)
+        {
+            const Board board("4k3/8/3q1r2/4P3/2N5/8/8/4K3 w - - 0 1");
+
+            const Move killer("c4", "a5");
+            const Move historyMove("e1", "e2");
+
+            SearchHistory history;
+            history.UpdateQuietCutoff(board, 8, 0, historyMove, MoveList(), PreviousMoves());
+            history.UpdateQuietCutoff(board, 8, 0, historyMove, MoveList(), PreviousMoves());
+            history.UpdateQuietCutoff(board, 1, 2, killer, MoveList(), PreviousMoves());
+
+            MoveList moveList = MoveGenerator::GenerateMoves(board);
+            MovePicker movePicker(moveList, board, Move(), history, 2, PreviousMoves());
+
+            for (int i = 0; i < 3; i++)
+            {
+                Assert::IsTrue(movePicker.PickNext().IsCapture());
+            }
+
+            Assert::IsTrue(movePicker.PickNext() == killer);
+            Assert::IsTrue(movePicker.PickNext() == historyMove);
+        }
+
+        // Test that captures which lose material are picked after the quiet moves
+        TEST_METHOD(TestPickBadCaptures)
+        {
+            const Board board("4k3/8/3p4/4p3/8/8/4Q3/4K3 w - - 0 1");
+
+            MoveList moveList = MoveGenerator::GenerateMoves(board);
+            MovePicker movePicker(moveList, board, Move());
+
+            Move lastMove;
+            while (movePicker.HasNext())
+            {
+                lastMove = movePicker.PickNext();
+            }
+
+            Assert::IsTrue(lastMove == Move("e2", "e5", true));
+        }
+    };
+}
@@ -0,0 +1,117 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "Board.h"
+#include "Perft.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ChessEngineTests
+{
+    using namespace ChessEngine;
+
+    TEST_CLASS(PerftTests)
+    {
+    public:
+
+        // Helper function testing that the nodes counted for a position match the known counts at each depth
+        void TestPerftForFEN(const std::string& FEN, const std::vector<uint64_t>& expectedNodes)
+        {
+            Board board(FEN);
+
+            for (unsigned char depth = 0; depth < expectedNodes.size(); depth++)
+            {
+                Assert::AreEqual(expectedNodes[depth], Perft::CountNodes(board, depth));
+            }
+
+            // Counting the nodes should leave the board as it was
+            Assert::AreEqual(FEN, board.GetFEN());
+        }
+
+        // Test the node counts for the positions (and depths) from https://www.chessprogramming.org/Perft_Results
+        TEST_METHOD(TestPerftResults)
+        {
+            // Initial position
+            TestPerftForFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", { 1, 20, 400, 8'902, 197'281 });
+
+            // Position 2 ('Kiwipete')
+            TestPerftForFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", { 1, 48, 2'039, 97'862 });
+
+            // Position 3
+            TestPerftForFEN("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", { 1, 14, 191, 2'812, 43'238 });
+
+            // Position 4
+            TestPerftForFEN("r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", { 1, 6, 264, 9'467 });
+
+            // Position 5
+            TestPerftForFEN("rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", { 1, 44, 1'486, 62'379 });
+
+            // Position 6
+            TestPerftForFEN("r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", { 1, 46, 2'079, 89'890 });
+        }
+
+        // Test that the divide lists each root move with the nodes below it, summing to the total
+        TEST_METHOD(TestDivide)
+        {
+            Board board("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+            const PerftResult result = Perft::Divide(board, 3);
+
+            Assert::AreEqual(uint64_t(97'862), result.nodes);
+            Assert::AreEqual(size_t(48), result.divide.size());
+
+            uint64_t total = 0;
+            for (const auto& [move, nodes] : result.divide)
+            {
+                total += nodes;
+
+                if (move == Move("e1", "g1", Move::Special::KingsideCastles))
+                {
+                    Assert::AreEqual(uint64_t(2'059), nodes);
+                }
+            }
+            Assert::AreEqual(result.nodes, total);
+        }
+
+        // Test that sharing the work between threads (with and without the hash table) gives the same divide
+        TEST_METHOD(TestDivideParallel)
+        {
+            Board board("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+            const PerftResult expected = Perft::Divide(board, 3);
+
+            for (const size_t hashSizeInMB : { 0, 1 })
+            {
+                const PerftResult result = Perft::DivideParallel(board, 3, 4, hashSizeInMB);
+
+                Assert::AreEqual(expected.nodes, result.nodes);
+                Assert::IsTrue(expected.divide == result.divide);
+
+                Assert::AreEqual(size_t(4), result.threads.size());
+
+                uint64_t total = 0;
+                for (const PerftThreadResult& threadResult : result.threads)
+                {
+                    total += threadResult.nodes;
+                }
+                Assert::AreEqual(result.nodes, total);
+            }
+        }
+
+        // Test that counts stored in the hash table can be probed only for the same position and depth
+        TEST_METHOD(TestHashTable)
+        {
+            PerftHashTable hashTable(1);
+
+            Assert::IsFalse(hashTable.Probe(0x1234, 3).has_value());
+
+            hashTable.Store(0x1234, 3, 97'862);
+
+            Assert::IsTrue(hashTable.Probe(0x1234, 3).has_value());
+            Assert::AreEqual(uint64_t(97'862), *hashTable.Probe(0x1234, 3));
+
+            Assert::IsFalse(hashTable.Probe(0x1234, 4).has_value());
+            Assert::IsFalse(hashTable.Probe(0x1234 + hashTable.GetNumEntries(), 3).has_value());
+        }
+    };
+}
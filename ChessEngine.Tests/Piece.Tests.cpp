@@ -91,5 +91,26 @@ namespace ChessEngineTests
             p = Piece(Piece::Type::King, false);
             Assert::IsFalse(p.IsWhite());
         }
+
+        TEST_METHOD(TestGetIndex)
+        {
+            // Test that every piece (type and colour) has a unique index within the range of indices
+            std::set<size_t> indices;
+
+            for (const auto& type : Piece::AllTypes)
+            {
+                for (const bool isWhite : { true, false })
+                {
+                    const size_t index = Piece(type, isWhite).GetIndex();
+
+                    Assert::IsTrue(index < Piece::NumIndices);
+                    Assert::IsTrue(index == Piece::IndexFromType(type, isWhite));
+
+                    indices.insert(index);
+                }
+            }
+
+            Assert::IsTrue(indices.size() == Piece::NumIndices);
+        }
     };
-}
+}
\ No newline at end of file
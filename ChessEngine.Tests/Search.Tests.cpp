@@ -0,0 +1,226 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "Board.h"
+#include "Move.h"
+#include "MoveGenerator.h"
+#include "Search.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ChessEngineTests
+{
+    using namespace ChessEngine;
+
+    TEST_CLASS(SearchTests)
+    {
+    public:
+
+        TEST_METHOD(TestCheckmateInOne)
+        {
+            Board board("r1bqkb1r/pppp1ppp/2n2n2/4p2Q/2B1P3/8/PPPP1PPP/RNB1K1NR w KQkq - 4 4");
+
+            Search search;
+            const auto [move, eval] = search.SearchPosition(board, 4);
+
+            Assert::IsTrue(move == Move("h5", "f7", true));
+            Assert::AreEqual(Search::CheckmateEval - 1, eval);
+        }
+
+        TEST_METHOD(TestCheckmateInOneShallow)
+        {
+            // The checkmating move is a quiet move ordered late, which must not be pruned at the root of a shallow search
+            for (const unsigned char depth : { 1, 2 })
+            {
+                Board board("6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 0 1");
+
+                Search search;
+                const auto [move, eval] = search.SearchPosition(board, depth);
+
+                Assert::IsTrue(move == Move("a1", "a8"));
+                Assert::AreEqual(Search::CheckmateEval - 1, eval);
+            }
+        }
+
+        TEST_METHOD(TestCheckmateOnFiftyMoves)
+        {
+            // Checkmate on the move which completes fifty moves without a capture or pawn move is still checkmate
+            Board board("6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 99 80");
+
+            Search search;
+            const auto [move, eval] = search.SearchPosition(board, 4);
+
+            Assert::IsTrue(move == Move("a1", "a8"));
+            Assert::AreEqual(Search::CheckmateEval - 1, eval);
+
+            // Otherwise every move (even a check) draws by the fifty move rule
+            Board drawBoard("k7/8/8/8/8/8/8/6QK w - - 99 80");
+            const auto [drawMove, drawEval] = search.SearchPosition(drawBoard, 4);
+
+            Assert::AreEqual(0, drawEval);
+        }
+
+        TEST_METHOD(TestCheckmateInTwo)
+        {
+            // The rooks mate in two moves (three ply) whatever black plays, the search should stop once this is found
+            Board board("7k/8/8/8/8/8/R7/1R4K1 w - - 0 1");
+
+            Search search;
+            const auto [move, eval] = search.SearchPosition(board, 8);
+
+            Assert::AreEqual(Search::CheckmateEval - 3, eval);
+            Assert::AreEqual(3, Search::GetCheckmateDistance(eval));
+            Assert::IsTrue(search.GetCompletedDepth() < 8);
+
+            // Black is checkmated sooner if they don't defend, so prefers the longest line
+            Board blackBoard("7k/1R6/8/8/8/8/R7/6K1 b - - 0 1");
+            const auto [blackMove, blackEval] = search.SearchPosition(blackBoard, 8);
+
+            Assert::AreEqual(Search::CheckmateEval - 2, blackEval);
+        }
+
+        TEST_METHOD(TestCheckmated)
+        {
+            Board board("7k/6Q1/6K1/8/8/8/8/8 b - - 0 1");
+
+            Search search;
+            const auto [move, eval] = search.SearchPosition(board, 4);
+
+            Assert::IsTrue(move == Move());
+            Assert::AreEqual(Search::CheckmateEval, eval);
+        }
+
+        TEST_METHOD(TestStalemate)
+        {
+            Board board("7k/5Q2/6K1/8/8/8/8/8 b - - 0 1");
+
+            Search search;
+            const auto [move, eval] = search.SearchPosition(board, 4);
+
+            Assert::IsTrue(move == Move());
+            Assert::AreEqual(0, eval);
+        }
+
+        TEST_METHOD(TestPrincipalVariation)
+        {
+            Board board("7k/8/8/8/8/8/R7/1R4K1 w - - 0 1");
+
+            Search search;
+            const auto [move, eval] = search.SearchPosition(board, 8);
+
+            // The principal variation starts with the best move and plays out the checkmate with legal moves
+            const MoveList& principalVariation = search.GetPrincipalVariation();
+            Assert::AreEqual(size_t(3), principalVariation.size());
+            Assert::IsTrue(principalVariation[0] == move);
+
+            for (const Move& pvMove : principalVariation)
+            {
+                const MoveList moves = MoveGenerator::GenerateMoves(board);
+                Assert::IsTrue(std::find(moves.begin(), moves.end(), pvMove) != moves.end());
+
+                board.MakeMove(pvMove);
+            }
+
+            Assert::IsTrue(MoveGenerator::IsInCheck(board));
+            Assert::IsTrue(MoveGenerator::GenerateMoves(board).empty());
+        }
+
+        TEST_METHOD(TestPrincipalVariationDepth)
+        {
+            Board board;
+
+            Search search;
+            const auto [move, eval] = search.SearchPosition(board, 4);
+
+            // The principal variation starts with the best move and is no longer than the depth searched
+            const MoveList& principalVariation = search.GetPrincipalVariation();
+            Assert::IsTrue(principalVariation.size() >= 1 && principalVariation.size() <= 4);
+            Assert::IsTrue(principalVariation[0] == move);
+        }
+
+        TEST_METHOD(TestMultipleLines)
+        {
+            Board board("4k3/8/8/2q1r1n1/3P1P2/8/8/3K4 w - - 0 1");
+
+            SearchLimits limits;
+            limits.maxDepth = 5;
+            limits.numLines = 3;
+
+            Search search;
+            const auto [move, eval] = search.SearchPosition(board, limits);
+
+            // The lines are ordered best first, each with a different move, and the first is the result of the search
+            const std::vector<SearchLine>& lines = search.GetLines();
+            Assert::AreEqual(size_t(3), lines.size());
+            Assert::IsTrue(lines[0].move == Move("d4", "c5", true));
+            Assert::IsTrue(lines[0].move == move);
+            Assert::AreEqual(eval, lines[0].eval);
+
+            for (size_t i = 0; i < lines.size(); i++)
+            {
+                Assert::IsTrue(lines[i].principalVariation[0] == lines[i].move);
+
+                for (size_t j = i + 1; j < lines.size(); j++)
+                {
+                    Assert::IsTrue(lines[i].eval >= lines[j].eval);
+                    Assert::IsTrue(lines[i].move != lines[j].move);
+                }
+            }
+
+            Assert::IsTrue(search.GetPrincipalVariation()[0] == move);
+        }
+
+        TEST_METHOD(TestMultipleLinesFewerMoves)
+        {
+            // There are fewer legal moves than lines asked for (all of which draw by insufficient material)
+            Board board("k7/8/8/8/8/8/8/K7 w - - 0 1");
+
+            SearchLimits limits;
+            limits.maxDepth = 3;
+            limits.numLines = 5;
+
+            Search search;
+            search.SearchPosition(board, limits);
+
+            Assert::AreEqual(size_t(3), search.GetLines().size());
+            for (const SearchLine& line : search.GetLines())
+            {
+                Assert::AreEqual(0, line.eval);
+            }
+        }
+
+        TEST_METHOD(TestIterationReporter)
+        {
+            Board board;
+
+            SearchLimits limits;
+            limits.maxDepth = 4;
+            limits.numLines = 2;
+
+            std::vector<unsigned char> depthsReported;
+
+            Search search;
+            search.SetIterationReporter([&](const unsigned char depth, const std::vector<SearchLine>& lines)
+            {
+                depthsReported.push_back(depth);
+                Assert::AreEqual(size_t(2), lines.size());
+            });
+            search.SearchPosition(board, limits);
+
+            Assert::AreEqual(size_t(4), depthsReported.size());
+            for (size_t i = 0; i < depthsReported.size(); i++)
+            {
+                Assert::AreEqual(static_cast<int>(i + 1), static_cast<int>(depthsReported[i]));
+            }
+        }
+
+        TEST_METHOD(TestIsCheckmateEval)
+        {
+            Assert::IsTrue(Search::IsCheckmateEval(Search::CheckmateEval - 5));
+            Assert::IsTrue(Search::IsCheckmateEval(-Search::CheckmateEval + 5));
+            Assert::IsFalse(Search::IsCheckmateEval(0));
+            Assert::IsFalse(Search::IsCheckmateEval(Search::CheckmateBound));
+            Assert::AreEqual(5, Search::GetCheckmateDistance(-Search::CheckmateEval + 5));
+        }
+    };
+}
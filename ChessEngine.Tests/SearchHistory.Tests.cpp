@@ -0,0 +1,124 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "Board.h"
+#include "Move.h"
+#include "MoveList.h"
+#include "Piece.h"
+#include "SearchHistory.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ChessEngineTests
+{
+    using namespace ChessEngine;
+
+    TEST_CLASS(SearchHistoryTests)
+    {
+    public:
+
+        // Test that the killer moves for a ply are kept distinct with the most recent first
+        TEST_METHOD(TestKillers)
+        {
+            SearchHistory history;
+
+            const Board board;
+
+            const Move move1("e2", "e4", Move::Special::DoublePawnPush);
+            const Move move2("g1", "f3");
+            const Move move3("b1", "c3");
+
+            history.UpdateQuietCutoff(board, 4, 3, move1, MoveList(), PreviousMoves());
+            history.UpdateQuietCutoff(board, 4, 3, move2, MoveList(), PreviousMoves());
+            history.UpdateQuietCutoff(board, 4, 3, move2, MoveList(), PreviousMoves());
+
+            Assert::IsTrue(history.GetKillers(3)[0] == move2);
+            Assert::IsTrue(history.GetKillers(3)[1] == move1);
+
+            history.UpdateQuietCutoff(board, 4, 3, move3, MoveList(), PreviousMoves());
+
+            Assert::IsTrue(history.GetKillers(3)[0] == move3);
+            Assert::IsTrue(history.GetKillers(3)[1] == move2);
+
+            // The killers of other ply are unaffected
+            Assert::IsTrue(history.GetKillers(2)[0] == Move());
+        }
+
+        // Test that the move causing a cutoff gains history and the quiet moves searched before it lose history
+        TEST_METHOD(TestHistory)
+        {
+            SearchHistory history;
+
+            const Board board;
+
+            const Move cutoff("g1", "f3");
+            const Move failed("b1", "c3");
+
+            history.UpdateQuietCutoff(board, 5, 0, cutoff, MoveList({ failed }), PreviousMoves());
+
+            Assert::AreEqual(25, history.GetHistory(true, cutoff));
+            Assert::AreEqual(-25, history.GetHistory(true, failed));
+
+            // The history of each player is separate
+            Assert::AreEqual(0, history.GetHistory(false, cutoff));
+
+            // The scores stay within the bound however many cutoffs there are
+            for (int i = 0; i < 1000; i++)
+            {
+                history.UpdateQuietCutoff(board, 60, 0, cutoff, MoveList({ failed }), PreviousMoves());
+            }
+
+            Assert::IsTrue(history.GetHistory(true, cutoff) <= SearchHistory::MaxHistory);
+            Assert::IsTrue(history.GetHistory(true, failed) >= -SearchHistory::MaxHistory);
+        }
+
+        // Test that the counter move and continuation histories are indexed by the previous moves
+        TEST_METHOD(TestCounterMoveAndContinuationHistory)
+        {
+            SearchHistory history;
+
+            const Board board("rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq - 0 2");
+
+            const PlayedMove previous1 = { Move("e7", "e5", Move::Special::DoublePawnPush), Piece::bp };
+            const PlayedMove previous2 = { Move("e2", "e4", Move::Special::DoublePawnPush), Piece::wp };
+            const PreviousMoves previousMoves = { previous1, previous2 };
+
+            const PlayedMove cutoff = { Move("g1", "f3"), Piece::wn };
+
+            history.UpdateQuietCutoff(board, 4, 2, cutoff.move, MoveList(), previousMoves);
+
+            Assert::IsTrue(history.GetCounterMove(previous1) == cutoff.move);
+            Assert::IsTrue(history.GetCounterMove(previous2) == Move());
+            Assert::IsTrue(history.GetCounterMove(PlayedMove()) == Move());
+
+            Assert::AreEqual(16, history.GetContinuationHistory(previous1, 1, cutoff));
+            Assert::AreEqual(16, history.GetContinuationHistory(previous2, 2, cutoff));
+            Assert::AreEqual(0, history.GetContinuationHistory(previous2, 1, cutoff));
+
+            Assert::AreEqual(48, history.GetQuietScore(true, cutoff, previousMoves));
+            Assert::AreEqual(16, history.GetQuietScore(true, cutoff, PreviousMoves()));
+        }
+
+        // Test that ageing clears the killers and halves the history scores
+        TEST_METHOD(TestAge)
+        {
+            SearchHistory history;
+
+            const Board board("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1");
+
+            const Move move("g8", "f6");
+
+            history.UpdateQuietCutoff(board, 6, 1, move, MoveList(), PreviousMoves());
+            Assert::AreEqual(36, history.GetHistory(false, move));
+
+            history.Age();
+
+            Assert::IsTrue(history.GetKillers(1)[0] == Move());
+            Assert::AreEqual(18, history.GetHistory(false, move));
+
+            history.Clear();
+
+            Assert::AreEqual(0, history.GetHistory(false, move));
+        }
+    };
+}
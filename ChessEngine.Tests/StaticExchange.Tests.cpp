@@ -0,0 +1,76 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "Board.h"
+#include "Helper.h"
+#include "Move.h"
+#include "StaticExchange.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ChessEngineTests
+{
+    using namespace ChessEngine;
+
+    TEST_CLASS(StaticExchangeTests)
+    {
+    public:
+
+        // Helper function testing the static exchange evaluation of a move in the position given by a FEN
+        void TestSEE(const std::string& FEN, const Move move, const int expectedSEE)
+        {
+            const Board board(FEN);
+
+            Assert::AreEqual(expectedSEE, StaticExchange::SEE(board, move), Helper::StringToWString(FEN).c_str());
+        }
+
+        // Test capturing pieces which are not defended
+        TEST_METHOD(TestUndefended)
+        {
+            TestSEE("1k1r4/1pp4p/p7/4p3/8/P5P1/1PP4P/2K1R3 w - - 0 1", Move("e1", "e5", true), 100);
+            TestSEE("4k3/8/8/3n4/8/2N5/8/4K3 w - - 0 1", Move("c3", "d5", true), 300);
+            TestSEE("4k3/8/8/3Pp3/8/8/8/4K3 w - e6 0 1", Move("d5", "e6", Move::Special::EnPassantCapture), 100);
+        }
+
+        // Test capturing pieces which are defended, where the capturing piece is lost
+        TEST_METHOD(TestDefended)
+        {
+            TestSEE("4k3/8/3p4/4p3/8/8/4Q3/4K3 w - - 0 1", Move("e2", "e5", true), -800);
+            TestSEE("4k3/8/2p5/3p4/8/4N3/8/4K3 w - - 0 1", Move("e3", "d5", true), -200);
+            TestSEE("4k3/8/2p5/3n4/8/2N5/8/4K3 w - - 0 1", Move("c3", "d5", true), 0);
+
+            // Moving a piece onto an attacked square without capturing loses the piece
+            TestSEE("4k3/8/2p5/8/8/2N5/8/4K3 w - - 0 1", Move("c3", "d5"), -300);
+        }
+
+        // Test that the pieces attacking through the pieces which capture before them join the sequence
+        TEST_METHOD(TestXRays)
+        {
+            // The rooks are doubled, so white wins the pawn
+            TestSEE("4k3/4r3/8/4p3/8/8/4R3/4R1K1 w - - 0 1", Move("e2", "e5", true), 100);
+
+            // Black's rooks are doubled too, so white loses the exchange
+            TestSEE("4k3/4r3/4r3/4p3/8/8/4R3/4R1K1 w - - 0 1", Move("e2", "e5", true), -400);
+
+            // A queen behind a bishop on the diagonal wins back the pawn after the bishop is recaptured
+            TestSEE("4k3/6p1/5n2/8/3B4/2Q5/8/4K3 w - - 0 1", Move("d4", "f6", true), 75);
+
+            // A long sequence with queens behind the rook and bishop on both sides, white loses the knight for a pawn
+            TestSEE("1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - - 0 1", Move("d3", "e5", true), -200);
+        }
+
+        // Test that the king only captures when the square is no longer defended
+        TEST_METHOD(TestKingCaptures)
+        {
+            TestSEE("3rk3/8/8/8/8/8/3p4/3RK3 w - - 0 1", Move("d1", "d2", true), 100);
+            TestSEE("3rk3/3r4/8/8/8/8/3p4/3RK3 w - - 0 1", Move("d1", "d2", true), -400);
+        }
+
+        // Test that promotions gain the value of the promoted piece over the pawn
+        TEST_METHOD(TestPromotions)
+        {
+            TestSEE("4k3/P7/8/8/8/8/8/4K3 w - - 0 1", Move("a7", "a8", false, true, Piece::Type::Queen), 800);
+            TestSEE("1r2k3/P7/8/8/8/8/8/4K3 w - - 0 1", Move("a7", "a8", false, true, Piece::Type::Queen), -100);
+        }
+    };
+}
@@ -0,0 +1,102 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "TimeManager.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ChessEngineTests
+{
+    using namespace ChessEngine;
+
+    using std::chrono::milliseconds;
+
+    TEST_CLASS(TimeManagerTests)
+    {
+    public:
+
+        // Test that a search without any time limits is never stopped
+        TEST_METHOD(TestUntimed)
+        {
+            TimeManager timeManager;
+            timeManager.Start(SearchLimits(), true);
+
+            Assert::IsFalse(timeManager.IsTimed());
+            Assert::IsTrue(timeManager.ShouldStartIteration());
+            Assert::IsFalse(timeManager.IsTimeUp());
+        }
+
+        // Test that a fixed time per move is used for both limits and is not adjusted
+        TEST_METHOD(TestMoveTime)
+        {
+            SearchLimits limits;
+            limits.moveTime = milliseconds(1000);
+
+            TimeManager timeManager;
+            timeManager.Start(limits, true);
+
+            Assert::IsTrue(timeManager.IsTimed());
+            Assert::AreEqual(950LL, static_cast<long long>(timeManager.GetSoftLimit().count()));
+            Assert::AreEqual(950LL, static_cast<long long>(timeManager.GetHardLimit().count()));
+
+            timeManager.Update(true, -500);
+            Assert::AreEqual(950LL, static_cast<long long>(timeManager.GetSoftLimit().count()));
+        }
+
+        // Test that the time on the clock is shared between the moves to go, using the clock of the player to move
+        TEST_METHOD(TestClockAllocation)
+        {
+            SearchLimits limits;
+            limits.whiteTime = milliseconds(60'050);
+            limits.blackTime = milliseconds(1'000);
+            limits.whiteIncrement = milliseconds(1'000);
+
+            TimeManager timeManager;
+
+            // Sudden death, the time is shared between the default number of moves plus most of the increment
+            timeManager.Start(limits, true);
+            Assert::AreEqual(60'000LL / TimeManager::DefaultMovesToGo + 750, static_cast<long long>(timeManager.GetSoftLimit().count()));
+            Assert::AreEqual(4 * (60'000LL / TimeManager::DefaultMovesToGo + 750), static_cast<long long>(timeManager.GetHardLimit().count()));
+
+            // With one move to go all the remaining time may be used
+            limits.movesToGo = 1;
+            timeManager.Start(limits, true);
+            Assert::AreEqual(60'000LL, static_cast<long long>(timeManager.GetSoftLimit().count()));
+            Assert::AreEqual(60'000LL, static_cast<long long>(timeManager.GetHardLimit().count()));
+
+            // Black's clock should be used for black
+            timeManager.Start(limits, false);
+            Assert::AreEqual(950LL, static_cast<long long>(timeManager.GetHardLimit().count()));
+        }
+
+        // Test that more time is used when the best move is unstable or the eval drops, and less when it is stable
+        TEST_METHOD(TestAdjustment)
+        {
+            SearchLimits limits;
+            limits.whiteTime = milliseconds(60'050);
+            limits.movesToGo = 30;
+
+            TimeManager timeManager;
+            timeManager.Start(limits, true);
+            Assert::AreEqual(2'000LL, static_cast<long long>(timeManager.GetSoftLimit().count()));
+
+            // The best move changed
+            timeManager.Update(true, 0);
+            Assert::AreEqual(3'000LL, static_cast<long long>(timeManager.GetSoftLimit().count()));
+
+            // The best move has been stable for several iterations
+            for (int i = 0; i < 4; i++)
+            {
+                timeManager.Update(false, 0);
+            }
+            Assert::AreEqual(1'400LL, static_cast<long long>(timeManager.GetSoftLimit().count()));
+
+            // The eval dropped by a pawn
+            timeManager.Update(false, -100);
+            Assert::AreEqual(2'100LL, static_cast<long long>(timeManager.GetSoftLimit().count()));
+
+            // The soft limit never exceeds the hard limit
+            Assert::IsTrue(timeManager.GetSoftLimit() <= timeManager.GetHardLimit());
+        }
+    };
+}
@@ -0,0 +1,112 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "Move.h"
+#include "TranspositionTable.h"
+
+#include "TestHelpers.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ChessEngineTests
+{
+    using namespace ChessEngine;
+
+    using Bound = TranspositionTableEntry::Bound;
+
+    TEST_CLASS(TranspositionTableTests)
+    {
+    public:
+
+        // Test that the properties of an entry can be set and retrieved
+        TEST_METHOD(TestEntry)
+        {
+            const TranspositionTableEntry uninitialized;
+            Assert::IsFalse(uninitialized.IsInitialized());
+
+            const Move move("e2", "e4", Move::Special::DoublePawnPush);
+            const TranspositionTableEntry entry(0xFEDC'BA98'7654'3210, 7, Bound::Lower, -1234, move, 42);
+
+            Assert::IsTrue(entry.IsInitialized());
+            Assert::IsTrue(entry.GetHash() == 0xFEDC'BA98'7654'3210);
+            Assert::IsTrue(entry.GetDepth() == 7);
+            Assert::IsTrue(entry.GetBound() == Bound::Lower);
+            Assert::AreEqual(-1234, entry.GetEval());
+            Assert::IsTrue(entry.GetMove() == move);
+            Assert::IsTrue(entry.GetAge() == 42);
+        }
+
+        // Test that entries which are stored can be probed, and those which are not can not
+        TEST_METHOD(TestStoreAndProbe)
+        {
+            TranspositionTable table(1);
+
+            const Move move("g1", "f3");
+
+            Assert::IsFalse(table.Probe(0x1234).has_value());
+
+            table.Store(0x1234, 5, Bound::Exact, 100, move);
+
+            const auto entry = table.Probe(0x1234);
+            Assert::IsTrue(entry.has_value());
+            Assert::AreEqual(TranspositionTableEntry(0x1234, 5, Bound::Exact, 100, move, table.GetAge()), *entry);
+
+            // A hash which maps to the same bucket should not be found
+            Assert::IsFalse(table.Probe(0x1234 + table.GetNumEntries()).has_value());
+
+            table.Clear();
+            Assert::IsFalse(table.Probe(0x1234).has_value());
+        }
+
+        // Test that storing a position again replaces the previous entry (but keeps the previous best move if there is no new one)
+        TEST_METHOD(TestStoreSamePosition)
+        {
+            TranspositionTable table(1);
+
+            const Move move("d2", "d4", Move::Special::DoublePawnPush);
+
+            table.Store(0x1234, 3, Bound::Lower, 50, move);
+            table.Store(0x1234, 4, Bound::Upper, -50, Move());
+
+            const auto entry = table.Probe(0x1234);
+            Assert::IsTrue(entry.has_value());
+            Assert::AreEqual(TranspositionTableEntry(0x1234, 4, Bound::Upper, -50, move, table.GetAge()), *entry);
+        }
+
+        // Test that when a bucket is full the shallowest and oldest entries are replaced first
+        TEST_METHOD(TestReplacement)
+        {
+            TranspositionTable table(1);
+
+            // Hashes which all map to the same bucket
+            const uint64_t numBuckets = table.GetNumEntries() / TranspositionTable::EntriesPerBucket;
+            auto hash = [numBuckets](const uint64_t i) -> uint64_t { return 7 + i * numBuckets; };
+
+            // Fill the bucket, the entry with the shallowest depth should be replaced
+            for (uint64_t i = 0; i < TranspositionTable::EntriesPerBucket; i++)
+            {
+                table.Store(hash(i), static_cast<unsigned char>(10 + i), Bound::Exact, 0, Move());
+            }
+
+            table.Store(hash(4), 1, Bound::Exact, 0, Move());
+
+            Assert::IsFalse(table.Probe(hash(0)).has_value());
+            for (uint64_t i = 1; i <= TranspositionTable::EntriesPerBucket; i++)
+            {
+                Assert::IsTrue(table.Probe(hash(i)).has_value());
+            }
+
+            // In a new search the old entries should be replaced before the new ones, even if somewhat deeper
+            table.IncrementAge();
+            table.Store(hash(5), 5, Bound::Exact, 0, Move());
+            table.Store(hash(6), 5, Bound::Exact, 0, Move());
+
+            Assert::IsTrue(table.Probe(hash(5)).has_value());
+            Assert::IsTrue(table.Probe(hash(6)).has_value());
+            Assert::IsFalse(table.Probe(hash(4)).has_value());
+            Assert::IsFalse(table.Probe(hash(1)).has_value());
+            Assert::IsTrue(table.Probe(hash(2)).has_value());
+            Assert::IsTrue(table.Probe(hash(3)).has_value());
+        }
+    };
+}
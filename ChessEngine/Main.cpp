@@ -1,19 +1,201 @@
+#include <chrono>
 #include <iostream>
 #include <iterator>
 #include <random>
+#include <string>
 
 #include "AsciiUI.h"
 #include "Board.h"
 #include "Game.h"
 #include "Move.h"
 #include "MoveGenerator.h"
+#include "MoveList.h"
+#include "Perft.h"
+#include "Search.h"
+#include "StaticExchange.h"
 
 using namespace ChessEngine;
 
-int main()
+namespace
 {
+    const std::string StartingFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+
+    // Run perft from the command line: ChessEngine perft <depth> [--threads <n>] [--hash <MB>] [FEN]
+    int RunPerft(int argc, char* argv[])
+    {
+        if (argc < 3)
+        {
+            std::cerr << "Usage: ChessEngine perft <depth> [--threads <n>] [--hash <MB>] [FEN]" << std::endl;
+            return 1;
+        }
+
+        const int depth = std::stoi(argv[2]);
+
+        unsigned int numThreads = 1;
+        size_t hashSizeInMB = 0;
+
+        // The FEN may be given either quoted as a single argument or unquoted as several
+        std::string FEN;
+        for (int i = 3; i < argc; i++)
+        {
+            const std::string arg(argv[i]);
+
+            if (arg == "--threads" && (i + 1) < argc)
+            {
+                numThreads = static_cast<unsigned int>(std::stoul(argv[++i]));
+            }
+            else if (arg == "--hash" && (i + 1) < argc)
+            {
+                hashSizeInMB = static_cast<size_t>(std::stoul(argv[++i]));
+            }
+            else
+            {
+                FEN += (FEN.empty() ? "" : " ") + arg;
+            }
+        }
+
+        Board board(FEN.empty() ? StartingFEN : FEN);
+
+        if (numThreads > 1 || hashSizeInMB > 0)
+        {
+            Perft::PrintResult(Perft::DivideParallel(board, static_cast<unsigned char>(depth), numThreads, hashSizeInMB));
+        }
+        else
+        {
+            Perft::PrintResult(Perft::Divide(board, static_cast<unsigned char>(depth)));
+        }
+
+        return 0;
+    }
+
+    // Benchmark static exchange evaluation from the command line: ChessEngine see <iterations> [FEN]
+    // Every capture in the position is evaluated the given number of times.
+    int RunSEEBenchmark(int argc, char* argv[])
+    {
+        if (argc < 3)
+        {
+            std::cerr << "Usage: ChessEngine see <iterations> [FEN]" << std::endl;
+            return 1;
+        }
+
+        const int iterations = std::stoi(argv[2]);
+
+        std::string FEN;
+        for (int i = 3; i < argc; i++)
+        {
+            FEN += (FEN.empty() ? "" : " ") + std::string(argv[i]);
+        }
+
+        // Kiwipete (see the perft tests) has plenty of captures, both winning and losing
+        const Board board(FEN.empty() ? "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1" : FEN);
+
+        MoveList captures;
+        MoveGenerator::GenerateMoves(board, captures, MoveGenerator::Mode::CapturesAndPromotions);
+
+        for (const Move& move : captures)
+        {
+            std::cout << move.GetLongAlgebraicString() << ": " << StaticExchange::SEE(board, move) << "\n";
+        }
+
+        // Accumulate the results so that the evaluations can't be optimized away
+        long long total = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+        {
+            for (const Move& move : captures)
+            {
+                total += StaticExchange::SEE(board, move);
+            }
+        }
+        const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+
+        const double numEvaluations = static_cast<double>(iterations) * captures.size();
+
+        std::cout
+            << "\n"
+            << "Evaluations: " << static_cast<long long>(numEvaluations) << " (checksum " << total << ")" << "\n"
+            << "Time: " << time.count() << " seconds" << "\n"
+            << "Evaluations per second: " << (time.count() > 0.0 ? numEvaluations / time.count() : 0.0) << "\n";
+
+        return 0;
+    }
+
+    // Analyse a position from the command line: ChessEngine analyse <depth> <lines> [FEN]
+    // The best lines (MultiPV) found by each iteration of the search are printed as the search progresses.
+    int RunAnalysis(int argc, char* argv[])
+    {
+        if (argc < 4)
+        {
+            std::cerr << "Usage: ChessEngine analyse <depth> <lines> [FEN]" << std::endl;
+            return 1;
+        }
+
+        SearchLimits limits;
+        limits.maxDepth = static_cast<unsigned char>(std::stoi(argv[2]));
+        limits.numLines = static_cast<unsigned char>(std::stoi(argv[3]));
+
+        std::string FEN;
+        for (int i = 4; i < argc; i++)
+        {
+            FEN += (FEN.empty() ? "" : " ") + std::string(argv[i]);
+        }
+
+        Board board(FEN.empty() ? StartingFEN : FEN);
+
+        Search search;
+        search.SetIterationReporter([](const unsigned char depth, const std::vector<SearchLine>& lines)
+        {
+            for (size_t i = 0; i < lines.size(); i++)
+            {
+                std::cout << "depth " << static_cast<int>(depth) << " line " << (i + 1) << " eval ";
+
+                if (Search::IsCheckmateEval(lines[i].eval))
+                {
+                    // The number of moves (not ply) until checkmate, -ve when black is checkmating
+                    const int moves = (Search::GetCheckmateDistance(lines[i].eval) + 1) / 2;
+                    std::cout << "mate " << (lines[i].eval > 0 ? moves : -moves);
+                }
+                else
+                {
+                    std::cout << lines[i].eval;
+                }
+
+                std::cout << " pv";
+                for (const Move& move : lines[i].principalVariation)
+                {
+                    std::cout << " " << move.GetLongAlgebraicString();
+                }
+                std::cout << "\n";
+            }
+            std::cout.flush();
+        });
+
+        search.SearchPosition(board, limits);
+
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1 && std::string(argv[1]) == "perft")
+    {
+        return RunPerft(argc, argv);
+    }
+
+    if (argc > 1 && std::string(argv[1]) == "see")
+    {
+        return RunSEEBenchmark(argc, argv);
+    }
+
+    if (argc > 1 && std::string(argv[1]) == "analyse")
+    {
+        return RunAnalysis(argc, argv);
+    }
+
     Game game;
     game.StartGame();
 
     return 0;
-}
\ No newline at end of file
+}